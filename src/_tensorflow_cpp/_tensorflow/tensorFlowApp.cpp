@@ -92,6 +92,18 @@ DLL_EXPORT bool PlayTicTacToeGameWithHistory(TicTacToeResultOnline* result, int
         return false;
     }
 }
+//
+// Trains and saves tictactoe_model.txt when it is missing; call once before the non-MINIMAX
+// modes of PlayTicTacToeGameWithHistory, which never train
+DLL_EXPORT bool TrainTicTacToeModel()
+{
+    try {
+        TicTacToeModelRegistry::Instance().TrainStandalone();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
 
 //
 DLL_EXPORT double Predict( double missionNumberToPredict )
@@ -0,0 +1,508 @@
+/*
+TETRIS AI BENCHMARK SUITE
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o __test/TetrisBenchmark _tetris/TetrisBenchmark.cpp -pthread
+
+Usage:
+
+__test/TetrisBenchmark [--file tetris_weights.txt] [--threads 0] [--repeat 5] [--out tetris_benchmark.json] [--compare baseline.json]
+
+Runs the fixed suite (SUITE_VERSION) on three engines across all cores:
+  instance   TetrisGameInstance::StepAI (the DLL path)
+  board      BoardEngine + FindBestMove (the TetrisBoard.cpp engine)
+  stateless  Engine:: functions on a BoardGrid (the TetrisBoardStateless.cpp engine)
+
+Each case is a seeded piece sequence (drawn like TetrisGameInstance::Reset(seed)) and a
+starting board with 0, 4 or 8 garbage rows. The whole suite runs --repeat times; lines are
+identical across runs, speed is not. Results go to --out as JSON: lines per case,
+mean/median with 95% confidence intervals, placements/sec per run and per case, and
+per-move latency percentiles.
+
+--compare loads a previous JSON and flags significant regressions: lines by a paired t-test
+over the same cases, speed by Welch's t-test over the per-run rates of both files. Cases
+within one run share that run's noise, so only whole runs count as samples. A slowdown
+must also exceed both 10% and twice the run-to-run variation. Needs at least two runs
+on each side. The exit code is 2 when a regression is flagged.
+*/
+
+#include "../include/TetrisEngine.h"
+#include "../include/TetrisSolver.h"
+#include "../include/TetrisEngineStateless.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- Suite v1 (changing anything here requires a new SUITE_VERSION) ---
+constexpr const char* SUITE_VERSION = "tetris-bench-v1";
+constexpr int SUITE_CASES = 64;
+constexpr int SUITE_MAX_MOVES = 500;
+constexpr uint32_t SUITE_BASE_SEED = 20240601;
+constexpr int SUITE_GARBAGE_ROWS[4] = {0, 0, 4, 8};
+constexpr int GARBAGE_CELL = 8;
+
+constexpr double SPEED_REGRESSION_MIN = 0.10; // ignore significant but smaller slowdowns
+constexpr double SPEED_NOISE_FACTOR = 2.0;    // ... and those within this many run-to-run CVs
+
+struct BenchCase {
+    uint32_t seed = 0;
+    int garbageRows = 0;
+    std::vector<int> board;     // BOARD_HEIGHT x BOARD_WIDTH, row-major
+    std::vector<int> pieces;
+};
+
+std::vector<BenchCase> BuildSuite() {
+    std::vector<BenchCase> suite(SUITE_CASES);
+    for (int i = 0; i < SUITE_CASES; ++i) {
+        BenchCase& c = suite[i];
+        c.seed = SUITE_BASE_SEED + i;
+        c.garbageRows = SUITE_GARBAGE_ROWS[i % 4];
+        c.pieces = TetrisEngine::Solver::SeededSequence(c.seed, SUITE_MAX_MOVES + 1);
+        c.board.assign(TetrisEngine::BOARD_HEIGHT * TetrisEngine::BOARD_WIDTH, 0);
+
+        // Raw mt19937 output (not a distribution) so the holes are identical on every standard library
+        std::mt19937 holes(c.seed ^ 0x9E3779B9u);
+        for (int r = TetrisEngine::BOARD_HEIGHT - c.garbageRows; r < TetrisEngine::BOARD_HEIGHT; ++r) {
+            int hole = static_cast<int>(holes() % TetrisEngine::BOARD_WIDTH);
+            for (int col = 0; col < TetrisEngine::BOARD_WIDTH; ++col)
+                c.board[r * TetrisEngine::BOARD_WIDTH + col] = col == hole ? 0 : GARBAGE_CELL;
+        }
+    }
+    return suite;
+}
+
+// --- Engines ---
+struct CaseResult {
+    int lines = 0;
+    int moves = 0;
+    double seconds = 0.0;
+    std::vector<float> latencyUs;
+};
+
+using BenchClock = std::chrono::steady_clock;
+
+inline float ElapsedUs(BenchClock::time_point from, BenchClock::time_point to) {
+    return std::chrono::duration<float, std::micro>(to - from).count();
+}
+
+CaseResult RunInstance(const BenchCase& c, const TetrisEngine::HeuristicWeights& w) {
+    CaseResult r;
+    TetrisEngine::TetrisGameInstance game(c.seed);
+    game.weights = w;
+    game.board.LoadFromArray(c.board.data());
+
+    auto start = BenchClock::now();
+    while (r.moves < SUITE_MAX_MOVES) {
+        auto t0 = BenchClock::now();
+        game.StepAI();
+        auto t1 = BenchClock::now();
+        if (game.gameOver) break;
+        r.latencyUs.push_back(ElapsedUs(t0, t1));
+        r.moves++;
+    }
+    r.seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    r.lines = game.lines;
+    return r;
+}
+
+CaseResult RunBoard(const BenchCase& c, const TetrisEngine::HeuristicWeights& w) {
+    CaseResult r;
+    TetrisEngine::BoardEngine board;
+    board.LoadFromArray(c.board.data());
+
+    auto start = BenchClock::now();
+    while (r.moves < SUITE_MAX_MOVES) {
+        int piece = c.pieces[r.moves];
+        auto t0 = BenchClock::now();
+        if (board.IsGameOver({piece, 0, 3, 0})) break;
+        auto m = TetrisEngine::FindBestMove(board, piece, w);
+        TetrisEngine::Piece p{piece, m.rotation, m.x, 0};
+        while (board.IsValid({piece, m.rotation, m.x, p.y + 1})) p.y++;
+        board.PlacePiece(p);
+        r.lines += board.ClearLines();
+        r.latencyUs.push_back(ElapsedUs(t0, BenchClock::now()));
+        r.moves++;
+    }
+    r.seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    return r;
+}
+
+CaseResult RunStateless(const BenchCase& c, const TetrisEngine::HeuristicWeights& w) {
+    CaseResult r;
+    HeuristicWeights weights{w.w_lines, w.w_height, w.w_holes, w.w_bumpiness};
+    BoardGrid grid;
+    for (int row = 0; row < BOARD_HEIGHT; ++row)
+        for (int col = 0; col < BOARD_WIDTH; ++col) grid[row][col] = c.board[row * BOARD_WIDTH + col];
+
+    auto start = BenchClock::now();
+    while (r.moves < SUITE_MAX_MOVES) {
+        int piece = c.pieces[r.moves];
+        auto t0 = BenchClock::now();
+        Piece p{piece, 0, 3, 0};
+        if (Engine::IsGameOver(grid, p)) break;
+        Move m = Engine::FindBestMove(grid, piece, weights);
+        p = {piece, m.rotation, m.x, 0};
+        while (Engine::IsValid(grid, {piece, m.rotation, m.x, p.y + 1})) p.y++;
+        grid = Engine::PlacePiece(grid, p);
+        r.lines += Engine::ClearLines(grid);
+        r.latencyUs.push_back(ElapsedUs(t0, BenchClock::now()));
+        r.moves++;
+    }
+    r.seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    return r;
+}
+
+// Engines with the same rules (shape table and drop logic) must clear the same lines
+struct EngineSpec {
+    const char* name;
+    const char* rules;
+    CaseResult (*run)(const BenchCase&, const TetrisEngine::HeuristicWeights&);
+};
+
+const EngineSpec ENGINES[] = {
+    {"instance", "TetrisEngine.h", RunInstance},
+    {"board", "TetrisEngine.h", RunBoard},
+    {"stateless", "TetrisEngineStateless.h", RunStateless},
+};
+constexpr int ENGINE_COUNT = sizeof(ENGINES) / sizeof(ENGINES[0]);
+
+// --- Statistics ---
+double Mean(const std::vector<double>& v) {
+    return v.empty() ? 0.0 : std::accumulate(v.begin(), v.end(), 0.0) / v.size();
+}
+
+double Variance(const std::vector<double>& v) {
+    if (v.size() < 2) return 0.0;
+    double m = Mean(v), sum = 0.0;
+    for (double x : v) sum += (x - m) * (x - m);
+    return sum / (v.size() - 1);
+}
+
+double Median(std::vector<double> v) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t n = v.size();
+    return n % 2 ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+// Two-sided 95% Student t critical value: exact table up to 30 degrees of freedom
+// (interpolated for fractional Welch dof), Cornish-Fisher expansion around z = 1.96 above
+double TCritical95(double dof) {
+    static const double table[31] = {0.0,   12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365,
+                                     2.306, 2.262,  2.228, 2.201, 2.179, 2.160, 2.145, 2.131,
+                                     2.120, 2.110,  2.101, 2.093, 2.086, 2.080, 2.074, 2.069,
+                                     2.064, 2.060,  2.056, 2.052, 2.048, 2.045, 2.042};
+    if (dof < 1) return std::numeric_limits<double>::infinity();
+    if (dof <= 30) {
+        int lo = static_cast<int>(dof);
+        double frac = dof - lo;
+        return frac > 0 ? table[lo] + frac * (table[lo + 1] - table[lo]) : table[lo];
+    }
+    const double z = 1.959964;
+    double z3 = z * z * z, z5 = z3 * z * z;
+    return z + (z3 + z) / (4 * dof) + (5 * z5 + 16 * z3 + 3 * z) / (96 * dof * dof);
+}
+
+// Percentile bootstrap interval of the median, fixed seed so reruns print the same interval
+std::pair<double, double> MedianCI95(const std::vector<double>& v) {
+    if (v.empty()) return {0.0, 0.0};
+    std::mt19937 rng(12345);
+    std::vector<double> medians(2000), sample(v.size());
+    for (auto& m : medians) {
+        for (auto& s : sample) s = v[rng() % v.size()];
+        m = Median(sample);
+    }
+    std::sort(medians.begin(), medians.end());
+    return {medians[medians.size() * 25 / 1000], medians[medians.size() * 975 / 1000]};
+}
+
+double Percentile(const std::vector<float>& sorted, double q) {
+    return sorted.empty() ? 0.0 : sorted[static_cast<size_t>(q * (sorted.size() - 1))];
+}
+
+struct EngineReport {
+    std::string name, rules;
+    std::vector<double> caseLines, caseRates, runRates;
+    double linesMean = 0, linesMeanLo = 0, linesMeanHi = 0;
+    double linesMedian = 0, linesMedianLo = 0, linesMedianHi = 0;
+    double placementsPerSec = 0;
+    double p50 = 0, p90 = 0, p99 = 0, maxUs = 0;
+};
+
+// 'results' holds every run's moves, seconds and latencies per case; 'runRates' one rate per run
+EngineReport Summarize(const EngineSpec& spec, const std::vector<CaseResult>& results,
+                       const std::vector<double>& runRates) {
+    EngineReport e;
+    e.name = spec.name;
+    e.rules = spec.rules;
+    e.runRates = runRates;
+    std::vector<float> latencies;
+    uint64_t moves = 0;
+    double seconds = 0.0;
+    for (const auto& r : results) {
+        e.caseLines.push_back(r.lines);
+        e.caseRates.push_back(r.seconds > 0 ? r.moves / r.seconds : 0.0);
+        latencies.insert(latencies.end(), r.latencyUs.begin(), r.latencyUs.end());
+        moves += r.moves;
+        seconds += r.seconds;
+    }
+    size_t n = e.caseLines.size();
+    e.linesMean = Mean(e.caseLines);
+    double half = TCritical95(static_cast<double>(n) - 1) * std::sqrt(Variance(e.caseLines) / n);
+    e.linesMeanLo = e.linesMean - half;
+    e.linesMeanHi = e.linesMean + half;
+    e.linesMedian = Median(e.caseLines);
+    std::tie(e.linesMedianLo, e.linesMedianHi) = MedianCI95(e.caseLines);
+
+    e.placementsPerSec = seconds > 0 ? moves / seconds : 0.0; // per core: case times are thread-local
+    std::sort(latencies.begin(), latencies.end());
+    e.p50 = Percentile(latencies, 0.50);
+    e.p90 = Percentile(latencies, 0.90);
+    e.p99 = Percentile(latencies, 0.99);
+    e.maxUs = latencies.empty() ? 0.0 : latencies.back();
+    return e;
+}
+
+// --- JSON ---
+void WriteArray(std::ostream& out, const std::vector<double>& v, int precision) {
+    out << "[" << std::setprecision(precision);
+    for (size_t i = 0; i < v.size(); ++i) out << (i ? "," : "") << v[i];
+    out << "]";
+}
+
+std::string ToJson(const std::vector<EngineReport>& engines, const TetrisEngine::HeuristicWeights& w,
+                   int threads, int repeat, double wallSec, bool enginesAgree) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(6)
+        << "{\n  \"suite\": \"" << SUITE_VERSION << "\",\n"
+        << "  \"cases\": " << SUITE_CASES << ",\n"
+        << "  \"max_moves\": " << SUITE_MAX_MOVES << ",\n"
+        << "  \"weights\": [" << w.w_lines << "," << w.w_height << "," << w.w_holes << "," << w.w_bumpiness << "],\n"
+        << "  \"threads\": " << threads << ",\n"
+        << "  \"repeat\": " << repeat << ",\n"
+        << std::setprecision(3) << "  \"wall_sec\": " << wallSec << ",\n"
+        << "  \"engines_agree\": " << (enginesAgree ? "true" : "false") << ",\n"
+        << "  \"engines\": [\n";
+    for (size_t i = 0; i < engines.size(); ++i) {
+        const auto& e = engines[i];
+        out << std::setprecision(3)
+            << "    {\"name\": \"" << e.name << "\", \"rules\": \"" << e.rules << "\""
+            << ", \"lines_mean\": " << e.linesMean
+            << ", \"lines_mean_ci95\": [" << e.linesMeanLo << "," << e.linesMeanHi << "]"
+            << ", \"lines_median\": " << e.linesMedian
+            << ", \"lines_median_ci95\": [" << e.linesMedianLo << "," << e.linesMedianHi << "]"
+            << ", \"placements_per_sec\": " << std::setprecision(1) << e.placementsPerSec
+            << ", \"latency_us\": {\"p50\": " << std::setprecision(3) << e.p50 << ", \"p90\": " << e.p90
+            << ", \"p99\": " << e.p99 << ", \"max\": " << e.maxUs << "}"
+            << ",\n     \"case_lines\": ";
+        WriteArray(out, e.caseLines, 0);
+        out << ",\n     \"case_placements_per_sec\": ";
+        WriteArray(out, e.caseRates, 1);
+        out << ",\n     \"run_placements_per_sec\": ";
+        WriteArray(out, e.runRates, 1);
+        out << "}" << (i + 1 < engines.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return out.str();
+}
+
+// Reads only what this program writes: the suite string and the per-case arrays of one engine
+bool ExtractString(const std::string& json, const std::string& key, std::string& value) {
+    size_t at = json.find("\"" + key + "\"");
+    if (at == std::string::npos) return false;
+    size_t open = json.find('"', json.find(':', at) + 1);
+    size_t close = json.find('"', open + 1);
+    if (open == std::string::npos || close == std::string::npos) return false;
+    value = json.substr(open + 1, close - open - 1);
+    return true;
+}
+
+bool ExtractEngineArray(const std::string& json, const std::string& engine, const std::string& key,
+                        std::vector<double>& values) {
+    size_t at = json.find("\"name\": \"" + engine + "\"");
+    if (at == std::string::npos) return false;
+    at = json.find("\"" + key + "\"", at);
+    if (at == std::string::npos) return false;
+    size_t open = json.find('[', at), close = json.find(']', open);
+    if (open == std::string::npos || close == std::string::npos) return false;
+    std::stringstream in(json.substr(open + 1, close - open - 1));
+    values.clear();
+    std::string item;
+    while (std::getline(in, item, ',')) values.push_back(std::atof(item.c_str()));
+    return true;
+}
+
+// --- Regression check ---
+int CompareToBaseline(const std::vector<EngineReport>& engines, const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open baseline " << path << "\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string json = buffer.str(), suite;
+    if (!ExtractString(json, "suite", suite) || suite != SUITE_VERSION) {
+        std::cerr << "Error: Baseline suite '" << suite << "' does not match " << SUITE_VERSION << "\n";
+        return 1;
+    }
+
+    std::cout << "\nComparison against " << path << "\n" << std::fixed;
+    int regressions = 0;
+    for (const auto& e : engines) {
+        std::vector<double> baseLines, baseRuns;
+        if (!ExtractEngineArray(json, e.name, "case_lines", baseLines) || baseLines.size() != e.caseLines.size()) {
+            std::cout << "  " << e.name << ": not in baseline, skipped\n";
+            continue;
+        }
+        // Baselines written before --repeat have no per-run rates
+        if (!ExtractEngineArray(json, e.name, "run_placements_per_sec", baseRuns)) baseRuns.clear();
+
+        // Lines: paired over identical cases
+        std::vector<double> diff(e.caseLines.size());
+        for (size_t i = 0; i < diff.size(); ++i) diff[i] = e.caseLines[i] - baseLines[i];
+        double meanDiff = Mean(diff), se = std::sqrt(Variance(diff) / diff.size());
+        double tLines = se > 0 ? meanDiff / se : 0.0;
+        bool linesRegressed = meanDiff < 0 && std::fabs(tLines) > TCritical95(diff.size() - 1.0);
+
+        std::cout << "  " << std::left << std::setw(10) << e.name << std::right << std::setprecision(2)
+                  << " lines " << std::showpos << meanDiff << std::noshowpos << " (t=" << tLines << ")"
+                  << (linesRegressed ? " REGRESSION" : "");
+
+        // Speed: Welch over whole-run rates, outside the run-to-run noise floor
+        const std::vector<double>& runs = e.runRates;
+        bool speedRegressed = false;
+        if (runs.size() < 2 || baseRuns.size() < 2) {
+            std::cout << ", speed not compared (needs --repeat >= 2 on both sides)\n";
+        } else {
+            double m1 = Mean(runs), m0 = Mean(baseRuns);
+            double v1 = Variance(runs) / runs.size(), v0 = Variance(baseRuns) / baseRuns.size();
+            double tSpeed = v0 + v1 > 0 ? (m1 - m0) / std::sqrt(v0 + v1) : 0.0;
+            double dof = v0 + v1 > 0 ? (v0 + v1) * (v0 + v1) /
+                         (v1 * v1 / (runs.size() - 1) + v0 * v0 / (baseRuns.size() - 1)) : 1.0;
+            double change = m0 > 0 ? (m1 - m0) / m0 : 0.0;
+            double noise = SPEED_NOISE_FACTOR * std::max(m1 > 0 ? std::sqrt(Variance(runs)) / m1 : 0.0,
+                                                         m0 > 0 ? std::sqrt(Variance(baseRuns)) / m0 : 0.0);
+            speedRegressed = change < -std::max(SPEED_REGRESSION_MIN, noise) && std::fabs(tSpeed) > TCritical95(dof);
+            std::cout << ", speed " << std::showpos << std::setprecision(1) << change * 100 << "%" << std::noshowpos
+                      << " (t=" << std::setprecision(2) << tSpeed << ", noise " << std::setprecision(1)
+                      << noise * 100 << "%)" << (speedRegressed ? " REGRESSION" : "") << "\n";
+        }
+        regressions += linesRegressed + speedRegressed;
+    }
+    std::cout << (regressions ? "Significant regressions found.\n" : "No significant regressions.\n");
+    return regressions ? 2 : 0;
+}
+
+bool LoadWeights(TetrisEngine::HeuristicWeights& w, const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) return false;
+    file >> w.w_lines >> w.w_height >> w.w_holes >> w.w_bumpiness;
+    return !file.fail();
+}
+
+int main(int argc, char* argv[]) {
+    std::string filename = "tetris_weights.txt", outPath = "tetris_benchmark.json", baselinePath;
+    int threads = 0, repeat = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--file" && i + 1 < argc) filename = argv[++i];
+        else if (arg == "--threads" && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (arg == "--repeat" && i + 1 < argc) repeat = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--out" && i + 1 < argc) outPath = argv[++i];
+        else if (arg == "--compare" && i + 1 < argc) baselinePath = argv[++i];
+        else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--file <weights>] [--threads <n>] [--repeat <runs>] [--out <json>] [--compare <baseline json>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (threads <= 0) threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    TetrisEngine::HeuristicWeights weights{0.760666, -0.510066, -0.35663, -0.184483};
+    if (!LoadWeights(weights, filename)) std::cout << "Could not load " << filename << ", using default weights\n";
+
+    auto suite = BuildSuite();
+    size_t tasks = ENGINE_COUNT * suite.size();
+    std::vector<std::vector<CaseResult>> results(ENGINE_COUNT, std::vector<CaseResult>(suite.size()));
+    std::vector<std::vector<double>> runRates(ENGINE_COUNT);
+    bool deterministic = true;
+
+    std::cout << "Running " << SUITE_VERSION << ": " << suite.size() << " cases x " << ENGINE_COUNT
+              << " engines on " << threads << " threads, " << repeat << " runs...\n";
+    auto start = BenchClock::now();
+    for (int run = 0; run < repeat; ++run) {
+        std::vector<std::vector<CaseResult>> pass(ENGINE_COUNT, std::vector<CaseResult>(suite.size()));
+        std::atomic<size_t> next{0};
+        auto worker = [&] {
+            for (size_t t = next++; t < tasks; t = next++) {
+                size_t engine = t / suite.size(), index = t % suite.size();
+                pass[engine][index] = ENGINES[engine].run(suite[index], weights);
+            }
+        };
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+
+        // One rate per engine and run; cases are pooled into 'results'
+        for (int e = 0; e < ENGINE_COUNT; ++e) {
+            uint64_t moves = 0;
+            double seconds = 0.0;
+            for (size_t i = 0; i < suite.size(); ++i) {
+                CaseResult& r = pass[e][i];
+                CaseResult& all = results[e][i];
+                moves += r.moves;
+                seconds += r.seconds;
+                if (run > 0) deterministic = deterministic && r.lines == all.lines;
+                all.lines = r.lines;
+                all.moves += r.moves;
+                all.seconds += r.seconds;
+                all.latencyUs.insert(all.latencyUs.end(), r.latencyUs.begin(), r.latencyUs.end());
+            }
+            runRates[e].push_back(seconds > 0 ? moves / seconds : 0.0);
+        }
+    }
+    double wallSec = std::chrono::duration<double>(BenchClock::now() - start).count();
+
+    std::vector<EngineReport> engines;
+    for (int e = 0; e < ENGINE_COUNT; ++e) engines.push_back(Summarize(ENGINES[e], results[e], runRates[e]));
+    if (!deterministic) std::cout << "Warning: lines differ between runs of the same case\n";
+    bool agree = true;
+    for (const auto& a : engines)
+        for (const auto& b : engines)
+            if (a.rules == b.rules) agree = agree && a.caseLines == b.caseLines;
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& e : engines) {
+        std::cout << "  " << std::left << std::setw(10) << e.name << std::right
+                  << " lines mean " << e.linesMean << " [" << e.linesMeanLo << ", " << e.linesMeanHi << "]"
+                  << ", median " << e.linesMedian << " [" << e.linesMedianLo << ", " << e.linesMedianHi << "]"
+                  << ", " << std::setprecision(0) << e.placementsPerSec << " placements/s"
+                  << std::setprecision(1) << ", p50 " << e.p50 << "us, p99 " << e.p99 << "us\n";
+    }
+    if (!agree) std::cout << "Warning: engines with the same rules disagree on lines\n";
+
+    std::ofstream out(outPath);
+    out << ToJson(engines, weights, threads, repeat, wallSec, agree);
+    if (!out.good()) {
+        std::cerr << "Error: Could not write " << outPath << "\n";
+        return 1;
+    }
+    std::cout << "Results written to " << outPath << "\n";
+
+    return baselinePath.empty() ? 0 : CompareToBaseline(engines, baselinePath);
+}
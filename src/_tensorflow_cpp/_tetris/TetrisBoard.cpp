@@ -5,9 +5,18 @@ Compile from root with:
 
 g++ -std=c++20  -o __test/TetrisBoard.exe  _tetris/TetrisBoard.cpp
 
+Profiling build (hot-path probes, see include/TetrisProfiler.h):
+
+g++ -std=c++20 -O2 -DTETRIS_PROFILE -o __test/TetrisBoardProfile.exe  _tetris/TetrisBoard.cpp
+
 */
 
 #include "../include/TetrisEngine.h"
+#include "../include/TetrisDataset.h"
+#include "../include/TetrisTelemetry.h"
+#include "../include/TetrisPipeline.h"
+#include "../include/TetrisReplay.h"
+#include "../include/LinearRegression.h"
 #include <iostream>
 #include <vector>
 #include <string>
@@ -18,6 +27,8 @@ g++ -std=c++20  -o __test/TetrisBoard.exe  _tetris/TetrisBoard.cpp
 #include <fstream>
 #include <sstream>
 #include <locale>
+#include <atomic>
+#include <cmath>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -49,31 +60,6 @@ void SetupConsole() {
 
 // --- Graphics ---
 constexpr bool USE_FANCY_GRAPHICS = true;
-const std::string RESET_COLOR = "\033[0m";
-const std::string EMPTY_COLOR = "\033[1;30m";
-const std::string I_COLOR = "\033[1;36m";
-const std::string O_COLOR = "\033[1;33m";
-const std::string T_COLOR = "\033[1;35m";
-const std::string S_COLOR = "\033[1;32m";
-const std::string Z_COLOR = "\033[1;31m";
-const std::string J_COLOR = "\033[1;34m";
-const std::string L_COLOR = "\033[1;91m";
-const std::string WALL_COLOR = "\033[1;37m";
-const std::string PREVIEW_COLOR = "\033[1;90m";
-
-std::string GetColor(int pieceId) {
-    if (!USE_FANCY_GRAPHICS) return "";
-    switch (pieceId) {
-        case 1: return I_COLOR;
-        case 2: return O_COLOR;
-        case 3: return T_COLOR;
-        case 4: return S_COLOR;
-        case 5: return Z_COLOR;
-        case 6: return J_COLOR;
-        case 7: return L_COLOR;
-        default: return EMPTY_COLOR;
-    }
-}
 
 void ClearScreen() {
     if (!USE_FANCY_GRAPHICS) {
@@ -92,6 +78,12 @@ constexpr double MUTATION_RATE = 0.1;
 constexpr double MUTATION_STRENGTH = 0.5;
 constexpr int TOURNAMENT_SIZE = 5;
 constexpr double ELITISM_RATE = 0.1;
+
+// --- Surrogate Pre-screen Constants (--surrogate) ---
+constexpr int SURROGATE_MIN_SAMPLES = 60;           // quadratic model over 4 weights has 15 terms
+constexpr double SURROGATE_REJECT_QUANTILE = 0.5;   // children predicted below this quantile of the last
+                                                    // simulated generation are skipped...
+constexpr double SURROGATE_EXPLORE_RATE = 0.2;      // ...except this share, simulated anyway to keep the model honest
 const std::string DEFAULT_WEIGHTS_FILE = "tetris_weights.txt";
 
 // --- GA Data Structures ---
@@ -122,32 +114,56 @@ bool LoadWeights(TetrisEngine::HeuristicWeights& w, const std::string& filename)
 }
 
 // --- GA Operations ---
-double SimulateGame(const TetrisEngine::HeuristicWeights& weights) {
+struct SimulationStats {
+    uint64_t moves = 0;
+    uint64_t placements = 0; // candidate placements scored by FindBestMove
+};
+
+// Plays one game drawing pieces from 'rng' (one generator per worker thread)
+double SimulateGame(const TetrisEngine::HeuristicWeights& weights, std::mt19937& rng, SimulationStats* stats = nullptr) {
+    TETRIS_PROBE(SIMULATE_GAME);
+    std::uniform_int_distribution<int> pieceDist(1, 7);
     TetrisEngine::BoardEngine board;
     int lines = 0, moves = 0;
-    int nextPiece = TetrisEngine::Random::Int(1, 7);
+    int nextPiece = pieceDist(rng);
     
     while (moves < MAX_MOVES_PER_GAME) {
         int currentPiece = nextPiece;
-        nextPiece = TetrisEngine::Random::Int(1, 7);
+        nextPiece = pieceDist(rng);
         TetrisEngine::Piece p{currentPiece, 0, 3, 0};
         if (board.IsGameOver(p)) break;
         
-        auto m = TetrisEngine::FindBestMove(board, currentPiece, weights);
+        int evaluated = 0;
+        auto m = TetrisEngine::FindBestMove(board, currentPiece, weights, &evaluated);
         p.rotation = m.rotation; p.x = m.x;
+        if (stats) stats->placements += evaluated;
         
-        int y = 0;
-        while (!board.IsValid({currentPiece, m.rotation, m.x, y})) y--;
-        p.y = y;
-        while (board.IsValid({currentPiece, m.rotation, m.x, p.y + 1})) p.y++;
+        {
+            TETRIS_PROBE(DROP);
+            int y = 0;
+            while (!board.IsValid({currentPiece, m.rotation, m.x, y})) y--;
+            p.y = y;
+            while (board.IsValid({currentPiece, m.rotation, m.x, p.y + 1})) p.y++;
+        }
         
-        board.PlacePiece(p);
-        lines += board.ClearLines();
+        {
+            TETRIS_PROBE(PLACE);
+            board.PlacePiece(p);
+        }
+        {
+            TETRIS_PROBE(CLEAR);
+            lines += board.ClearLines();
+        }
         moves++;
     }
+    if (stats) stats->moves += moves;
     return static_cast<double>(lines);
 }
 
+double SimulateGame(const TetrisEngine::HeuristicWeights& weights) {
+    return SimulateGame(weights, TetrisEngine::Random::Generator());
+}
+
 Individual TournamentSelection(const std::vector<Individual>& pop) {
     Individual best{{}, std::numeric_limits<double>::lowest()};
     for (int i = 0; i < TOURNAMENT_SIZE; ++i) {
@@ -173,18 +189,133 @@ void Mutate(TetrisEngine::HeuristicWeights& w) {
     if (TetrisEngine::Random::Double(0,1) < MUTATION_RATE) w.w_bumpiness += TetrisEngine::Random::Normal(0, MUTATION_STRENGTH);
 }
 
-TetrisEngine::HeuristicWeights RunGeneticAlgorithm() {
+// Scores the individuals listed in 'which' on all cores. Each game gets a seed drawn up
+// front from the global generator, so results do not depend on thread scheduling.
+void EvaluatePopulation(std::vector<Individual>& pop, const std::vector<size_t>& which,
+                        TetrisEngine::GenerationMetrics& metrics) {
+    std::vector<uint32_t> seeds(which.size() * NUM_GAMES_PER_FITNESS_TEST);
+    for (auto& seed : seeds) seed = TetrisEngine::Random::Generator()();
+
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    workers = std::max(1, std::min<int>(workers, static_cast<int>(which.size())));
+
+    std::atomic<size_t> next{0};
+    std::atomic<uint64_t> placements{0}, busyNs{0};
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&]() {
+        SimulationStats stats;
+        auto busyStart = std::chrono::steady_clock::now();
+        for (size_t i = next++; i < which.size(); i = next++) {
+            double f = 0;
+            for (int g = 0; g < NUM_GAMES_PER_FITNESS_TEST; ++g) {
+                std::mt19937 rng(seeds[i * NUM_GAMES_PER_FITNESS_TEST + g]);
+                f += SimulateGame(pop[which[i]].weights, rng, &stats);
+            }
+            pop[which[i]].fitness = f / NUM_GAMES_PER_FITNESS_TEST;
+        }
+        busyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - busyStart).count();
+        placements += stats.placements;
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < workers; ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double sum = 0, sumSq = 0, best = std::numeric_limits<double>::lowest();
+    for (size_t i : which) {
+        sum += pop[i].fitness;
+        sumSq += pop[i].fitness * pop[i].fitness;
+        best = std::max(best, pop[i].fitness);
+    }
+    double mean = sum / which.size();
+
+    metrics.bestFitness = best;
+    metrics.meanFitness = mean;
+    metrics.stddevFitness = std::sqrt(std::max(0.0, sumSq / which.size() - mean * mean));
+    metrics.gamesSimulated = seeds.size();
+    metrics.placementsEvaluated = placements;
+    metrics.workers = workers;
+    metrics.generationSec = wall;
+    metrics.gamesPerSec = wall > 0 ? seeds.size() / wall : 0.0;
+    metrics.placementsPerSec = wall > 0 ? placements / wall : 0.0;
+    metrics.workerUtilization = wall > 0 ? busyNs * 1e-9 / (wall * workers) : 0.0;
+}
+
+// Quadratic ridge model of fitness over the four weights, fitted on every simulated
+// (weights, fitness) pair seen so far
+class FitnessSurrogate {
+public:
+    void Add(const TetrisEngine::HeuristicWeights& w, double fitness) {
+        samples.push_back(ToInputs(w));
+        fitness_.push_back(fitness);
+    }
+
+    bool Ready() const { return ready; }
+
+    void Refit() {
+        if (samples.size() >= static_cast<size_t>(SURROGATE_MIN_SAMPLES)) ready = model.fit(samples, fitness_);
+    }
+
+    double Predict(const TetrisEngine::HeuristicWeights& w) const { return model.predict(ToInputs(w)); }
+
+private:
+    static std::vector<double> ToInputs(const TetrisEngine::HeuristicWeights& w) {
+        return {w.w_lines, w.w_height, w.w_holes, w.w_bumpiness};
+    }
+
+    MultipleLinearRegression model{4, true, 1e-2};
+    std::vector<std::vector<double>> samples;
+    std::vector<double> fitness_;
+    bool ready = false;
+};
+
+TetrisEngine::HeuristicWeights RunGeneticAlgorithm(TetrisEngine::TelemetrySink* telemetry = nullptr,
+                                                   bool useSurrogate = false) {
     std::vector<Individual> pop(POPULATION_SIZE);
     for (auto& ind : pop) ind.weights = TetrisEngine::HeuristicWeights::RandomWeights();
 
-    std::cout << "Starting Genetic Algorithm training...\n";
+    // Individuals still to simulate; children rejected by the surrogate keep their predicted fitness
+    std::vector<size_t> pending(POPULATION_SIZE);
+    for (size_t i = 0; i < pending.size(); ++i) pending[i] = i;
+    std::vector<double> predicted(POPULATION_SIZE, 0.0);
+    std::vector<char> hasPrediction(POPULATION_SIZE, 0);
+    FitnessSurrogate surrogate;
+    uint64_t totalSaved = 0;
+
+    auto trainingStart = std::chrono::steady_clock::now();
+    std::cout << "Starting Genetic Algorithm training" << (useSurrogate ? " (surrogate pre-screen)" : "") << "...\n";
     for (int gen = 0; gen < NUM_GENERATIONS; ++gen) {
         // Evaluate fitness
-        for (auto& ind : pop) {
-            double f = 0;
-            for (int i = 0; i < NUM_GAMES_PER_FITNESS_TEST; ++i)
-                f += SimulateGame(ind.weights);
-            ind.fitness = f / NUM_GAMES_PER_FITNESS_TEST;
+        TetrisEngine::GenerationMetrics metrics;
+        metrics.generation = gen + 1;
+        EvaluatePopulation(pop, pending, metrics);
+        metrics.gamesSaved = static_cast<uint64_t>(POPULATION_SIZE - pending.size()) * NUM_GAMES_PER_FITNESS_TEST;
+        metrics.elapsedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - trainingStart).count();
+        if (telemetry) telemetry->Publish(metrics);
+
+        double threshold = 0.0;
+        if (useSurrogate) {
+            double absError = 0.0;
+            int checked = 0;
+            std::vector<double> simulated;
+            for (size_t i : pending) {
+                surrogate.Add(pop[i].weights, pop[i].fitness);
+                simulated.push_back(pop[i].fitness);
+                if (hasPrediction[i]) { absError += std::fabs(predicted[i] - pop[i].fitness); checked++; }
+            }
+            surrogate.Refit();
+            std::sort(simulated.begin(), simulated.end());
+            threshold = simulated[static_cast<size_t>(SURROGATE_REJECT_QUANTILE * (simulated.size() - 1))];
+
+            totalSaved += metrics.gamesSaved;
+            std::cout << "  Surrogate: simulated " << pending.size() << "/" << POPULATION_SIZE
+                      << ", saved " << metrics.gamesSaved << " games";
+            if (checked) std::cout << ", MAE " << std::setprecision(1) << absError / checked << " lines" << std::setprecision(4);
+            std::cout << "\n";
         }
 
         std::sort(pop.begin(), pop.end(), std::greater<Individual>());
@@ -201,150 +332,299 @@ TetrisEngine::HeuristicWeights RunGeneticAlgorithm() {
             Mutate(child);
             newPop.push_back({child, 0.0});
         }
+
+        // Elites are always re-simulated; children predicted clearly worse than the current
+        // population are skipped, apart from a random exploration quota
+        pending.clear();
+        std::fill(hasPrediction.begin(), hasPrediction.end(), 0);
+        for (size_t i = 0; i < newPop.size(); ++i) {
+            if (static_cast<int>(i) < elite || !useSurrogate || !surrogate.Ready()) {
+                pending.push_back(i);
+                continue;
+            }
+            predicted[i] = surrogate.Predict(newPop[i].weights);
+            hasPrediction[i] = 1;
+            if (predicted[i] >= threshold || TetrisEngine::Random::Double(0, 1) < SURROGATE_EXPLORE_RATE) {
+                pending.push_back(i);
+            } else {
+                newPop[i].fitness = predicted[i];
+            }
+        }
         pop = newPop;
 
         std::cout << "Gen " << gen+1 << ": Best=" << pop[0].fitness << " ";
         PrintWeights(pop[0].weights); std::cout << "\n";  // FIXED: Use free function
     }
     std::cout << "Training complete!\n";
+    if (useSurrogate) {
+        std::cout << "Surrogate saved " << totalSaved << " of "
+                  << static_cast<uint64_t>(NUM_GENERATIONS) * POPULATION_SIZE * NUM_GAMES_PER_FITNESS_TEST
+                  << " games\n";
+    }
+    if (TetrisEngine::Profiler::Enabled) TetrisEngine::Profiler::Dump(std::cout);
     return pop[0].weights;
 }
 
 // --- Console Rendering ---
-void RenderBoard(const TetrisEngine::BoardEngine& board, int score, int lines, int level,
-                 const TetrisEngine::Piece* currentPiece = nullptr, int nextPieceId = 0) {
-    auto tempGrid = board.GetGrid();
-    
-    if (currentPiece && board.IsValid(*currentPiece)) {
-        const auto& shape = currentPiece->GetShape();
-        for (int r = 0; r < 4; ++r) {
-            for (int c = 0; c < 4; ++c) {
-                if (shape[r][c] != 0) {
-                    int py = currentPiece->y + r;
-                    int px = currentPiece->x + c;
-                    // FIXED: Add TetrisEngine:: namespace
-                    if (py >= 0 && py < TetrisEngine::BOARD_HEIGHT && px >= 0 && px < TetrisEngine::BOARD_WIDTH) {
-                        tempGrid[py][px] = shape[r][c];
-                    }
-                }
-            }
-        }
+TetrisConsole::FrameRenderer& Renderer() {
+    static TetrisConsole::FrameRenderer renderer(USE_FANCY_GRAPHICS);
+    return renderer;
+}
+
+// --- Visual Game Loop ---
+// Adapter for TetrisConsole::SimulateGame
+struct VisibleGameEngine {
+    TetrisEngine::BoardEngine board;
+    const TetrisEngine::HeuristicWeights& w;
+
+    int RandomPiece() { return TetrisEngine::Random::Int(1, 7); }
+    bool IsGameOver(int piece) { return board.IsGameOver({piece, 0, 3, 0}); }
+    void BestMove(int piece, int& rotation, int& x) {
+        auto m = TetrisEngine::FindBestMove(board, piece, w);
+        rotation = m.rotation;
+        x = m.x;
     }
+    bool IsValid(int piece, int rotation, int x, int y) { return board.IsValid({piece, rotation, x, y}); }
+    int Lock(int piece, int rotation, int x, int y) {
+        board.PlacePiece({piece, rotation, x, y});
+        return board.ClearLines();
+    }
+};
 
-    if (!USE_FANCY_GRAPHICS) {
-        std::cout << "+----------------------+      Next:\n";
-        // FIXED: Add TetrisEngine:: namespace
-        for (int r = 0; r < TetrisEngine::BOARD_HEIGHT; ++r) {
-            std::cout << "|";
-            // FIXED: Add TetrisEngine:: namespace
-            for (int c = 0; c < TetrisEngine::BOARD_WIDTH; ++c) {
-                std::cout << (tempGrid[r][c] == 0 ? " ." : " #");
-            }
-            std::cout << " |";
-            if (r == 0) std::cout << "      Next";
-            else if (r == 1) std::cout << "      ----";
-            else if (r >= 2 && r <= 5 && nextPieceId > 0) {
-                const auto& nextShape = TetrisEngine::TETROMINO_SHAPES[nextPieceId - 1][0];
-                int previewRow = r - 2;
-                std::cout << "      ";
-                for (int c = 0; c < 4; ++c) {
-                    std::cout << (nextShape[previewRow][c] != 0 ? "# " : "  ");
-                }
-            }
-            if (r == 7) std::cout << "  Score: " << score;
-            if (r == 9) std::cout << "  Lines: " << lines;
-            if (r == 11) std::cout << "  Level: " << level;
-            std::cout << "\n";
-        }
-        std::cout << "+----------------------+\n";
-        return;
+// The AI plays on a background thread and publishes events; this thread only renders
+void PlayVisibleGame(const TetrisEngine::HeuristicWeights& w) {
+    TetrisConsole::EventRing ring;
+
+    std::thread simulation([&ring, &w] {
+        VisibleGameEngine engine{{}, w};
+        TetrisConsole::SimulateGame(engine, ring);
+    });
+
+    Renderer().Invalidate();
+    TetrisConsole::PlaybackRenderer playback(Renderer(), TetrisEngine::TETROMINO_SHAPES);
+    auto stats = playback.Run(ring);
+    simulation.join();
+
+    ClearScreen();
+    std::cout << "--- GAME OVER ---\nFinal Score: " << playback.Score() << "\nFinal Lines: " << playback.Lines() << "\n"
+              << "Frames shown: " << stats.framesShown << ", dropped: " << stats.framesDropped
+              << ", max backlog: " << stats.maxBacklog << " events\n";
+}
+
+// --- Training Data Generation ---
+bool GenerateTrainingData(const TetrisEngine::HeuristicWeights& w, const std::string& path,
+                          int games, int threads, bool useSearch, uint64_t seed) {
+    TetrisEngine::Dataset::GeneratorConfig cfg;
+    cfg.weights = w;
+    cfg.games = games;
+    cfg.maxMovesPerGame = MAX_MOVES_PER_GAME;
+    cfg.threads = threads;
+    cfg.useSearch = useSearch;
+    cfg.seed = seed;
+
+    std::cout << "Generating " << games << " games into " << path
+              << (useSearch ? " (lookahead search)" : "") << "...\n";
+
+    TetrisEngine::Dataset::GeneratorStats stats;
+    if (!TetrisEngine::Dataset::GenerateDataset(path.c_str(), cfg, &stats)) {
+        std::cerr << "Error: Failed to write dataset to " << path << "\n";
+        return false;
     }
 
-    std::cout << WALL_COLOR << "╔═════════════════════╗" << PREVIEW_COLOR << "     " << RESET_COLOR << "\n";
-    // FIXED: Add TetrisEngine:: namespace
-    for (int r = 0; r < TetrisEngine::BOARD_HEIGHT; ++r) {
-        std::cout << WALL_COLOR << "║" << RESET_COLOR;
-        // FIXED: Add TetrisEngine:: namespace
-        for (int c = 0; c < TetrisEngine::BOARD_WIDTH; ++c) {
-            std::cout << (tempGrid[r][c] == 0 ? 
-                std::string(EMPTY_COLOR + " ." + RESET_COLOR) : 
-                std::string(GetColor(tempGrid[r][c]) + " ■" + RESET_COLOR));
-        }
-        std::cout << WALL_COLOR << " ║" << RESET_COLOR;
-        if (r == 0) std::cout << PREVIEW_COLOR << "      Next" << RESET_COLOR;
-        else if (r == 1) std::cout << PREVIEW_COLOR << "      ────" << RESET_COLOR;
-        else if (r >= 2 && r <= 5 && nextPieceId > 0) {
-            const auto& nextShape = TetrisEngine::TETROMINO_SHAPES[nextPieceId - 1][0];
-            int previewRow = r - 2;
-            std::cout << PREVIEW_COLOR << "      " << RESET_COLOR;
-            for (int c = 0; c < 4; ++c) {
-                std::cout << (nextShape[previewRow][c] != 0 ? 
-                    std::string(GetColor(nextShape[previewRow][c]) + "■ " + RESET_COLOR) : "  ");
-            }
-        }
-        if (r == 7) std::cout << "  Score: " << score;
-        if (r == 9) std::cout << "  Lines: " << lines;
-        if (r == 11) std::cout << "  Level: " << level;
-        std::cout << "\n";
+    double perMinute = stats.seconds > 0 ? stats.records / stats.seconds * 60.0 : 0.0;
+    std::cout << std::fixed << std::setprecision(2)
+              << "Records: " << stats.records << ", Lines: " << stats.lines
+              << ", Time: " << stats.seconds << "s"
+              << ", Throughput: " << std::setprecision(0) << perMinute << " records/min\n";
+    return true;
+}
+
+bool InspectDataset(const std::string& path) {
+    TetrisEngine::Dataset::DatasetReader reader;
+    if (!reader.Open(path.c_str())) {
+        std::cerr << "Error: " << path << " is not a readable dataset file\n";
+        return false;
+    }
+
+    uint64_t pieces[8] = {};
+    uint64_t eventual = 0;
+    size_t gameStarts = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& rec : reader) {
+        pieces[rec.piece & 7]++;
+        eventual += rec.eventualLines;
+        bool empty = true;
+        for (uint8_t b : rec.cells) if (b) { empty = false; break; }
+        if (empty) gameStarts++;
     }
-    std::cout << WALL_COLOR << "╚═════════════════════╝" << RESET_COLOR << "\n";
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Records: " << reader.Size() << " (seed " << reader.Seed() << ", ~" << gameStarts << " games)\n";
+    std::cout << "Pieces:";
+    for (int i = 1; i <= 7; ++i) std::cout << " " << pieces[i];
+    std::cout << std::fixed << std::setprecision(3)
+              << "\nMean eventual lines: " << (reader.Size() ? double(eventual) / reader.Size() : 0.0)
+              << "\nScan time: " << seconds << "s\n";
+    return true;
 }
 
-// --- Visual Game Loop ---
-void PlayVisibleGame(const TetrisEngine::HeuristicWeights& w) {
-    ClearScreen();
+// --- Evaluator Benchmark ---
+// Cost per candidate of the linear heuristic vs the MLP, on positions from real games
+void BenchmarkEvaluators(const TetrisEngine::HeuristicWeights& w, const std::string& mlpFile) {
+    TetrisEngine::MLPEvaluator mlp = TetrisEngine::MLPEvaluator::Random(7);
+    if (!mlpFile.empty() && !mlp.Load(mlpFile)) {
+        std::cerr << "Warning: Could not load MLP from " << mlpFile << ", using random weights\n";
+    }
+
+    // Collect candidate sets from a seeded linear-heuristic game
+    constexpr int POSITIONS = 2000;
+    std::vector<std::vector<TetrisEngine::Candidate>> sets;
+    std::vector<std::pair<TetrisEngine::BoardEngine, int>> boards;
+    std::mt19937 rng(2024);
     TetrisEngine::BoardEngine board;
-    int score = 0, lines = 0, level = 1;
-    int nextPieceId = TetrisEngine::Random::Int(1, 7);
-    bool over = false;
+    while (static_cast<int>(sets.size()) < POSITIONS) {
+        int pieceId = static_cast<int>(rng() % 7) + 1;
+        if (board.IsGameOver({pieceId, 0, 3, 0})) { board.Reset(); continue; }
+        std::vector<TetrisEngine::Candidate> cands(TetrisEngine::MAX_CANDIDATES);
+        cands.resize(TetrisEngine::EnumerateCandidates(board, pieceId, cands.data()));
+        sets.push_back(std::move(cands));
+        boards.push_back({board, pieceId});
 
-    std::cout << "--- AI Playing Tetris ---\n";
-    
-    while (!over) {
-        int currentPieceId = nextPieceId;
-        nextPieceId = TetrisEngine::Random::Int(1, 7);
-        TetrisEngine::Piece p{currentPieceId, 0, 3, 0};
-        
-        if (board.IsGameOver(p)) { over = true; break; }
-        
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
-        RenderBoard(board, score, lines, level, &p, nextPieceId);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        
-        auto m = TetrisEngine::FindBestMove(board, currentPieceId, w);
-        p.rotation = m.rotation; p.x = m.x;
-        
-        int y = 0;
-        while (!board.IsValid({currentPieceId, m.rotation, m.x, y})) y--;
-        int finalY = y;
-        while (board.IsValid({currentPieceId, m.rotation, m.x, finalY + 1})) finalY++;
-        
-        // Animation
-        for (int dropY = y; dropY <= finalY; ++dropY) {
-            p.y = dropY;
-            ClearScreen();
-            std::cout << "--- AI Playing ---\n";
-            RenderBoard(board, score, lines, level, &p, nextPieceId);
-            std::this_thread::sleep_for(std::chrono::milliseconds(30));
-        }
-        
-        p.y = finalY;
+        auto m = TetrisEngine::FindBestMove(board, pieceId, w);
+        TetrisEngine::Piece p{pieceId, m.rotation, m.x, 0};
+        while (!board.IsValid(p)) p.y--;
+        while (board.IsValid({pieceId, m.rotation, m.x, p.y + 1})) p.y++;
         board.PlacePiece(p);
-        int cleared = board.ClearLines();
-        if (cleared) {
-            lines += cleared;
-            score += cleared * cleared * 100 * level;
-            level = 1 + (lines / 10);
-        }
-        
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
-        RenderBoard(board, score, lines, level, nullptr, nextPieceId);
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        board.ClearLines();
     }
-    ClearScreen();
-    std::cout << "--- GAME OVER ---\nFinal Score: " << score << "\nFinal Lines: " << lines << "\n";
+    long long candidates = 0;
+    for (const auto& c : sets) candidates += c.size();
+
+    auto time = [&](auto&& fn) {
+        constexpr int REPEAT = 20;
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < REPEAT; ++rep) fn();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+               / (static_cast<double>(candidates) * REPEAT);
+    };
+
+    volatile double sink = 0;
+    double scores[TetrisEngine::MAX_CANDIDATES];
+    auto scoreAll = [&](const auto& eval) {
+        return time([&] {
+            for (const auto& c : sets) {
+                eval.ScoreBatch(c.data(), static_cast<int>(c.size()), scores);
+                sink = sink + scores[0];
+            }
+        });
+    };
+
+    TetrisEngine::LinearEvaluator linear{w};
+    TetrisEngine::MLPEvaluator scalar = mlp;
+    scalar.useSimd = false;
+
+    double fullLinear = time([&] {
+        for (const auto& [b, id] : boards) sink = sink + TetrisEngine::FindBestMove(b, id, w).score;
+    });
+    double fullMlp = time([&] {
+        for (const auto& [b, id] : boards) sink = sink + TetrisEngine::FindBestMoveBatched(b, id, mlp).score;
+    });
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Positions: " << sets.size() << ", candidates: " << candidates << "\n"
+              << "Scoring only (ns/candidate):\n"
+              << "  linear        " << scoreAll(linear) << "\n"
+              << "  mlp scalar    " << scoreAll(scalar) << "\n"
+              << "  mlp avx2/fma  " << (TetrisEngine::MLPEvaluator::HasAvx2() ? scoreAll(mlp) : 0.0)
+              << (TetrisEngine::MLPEvaluator::HasAvx2() ? "" : " (not supported on this CPU)") << "\n"
+              << "Full move search (ns/candidate, incl. drop/place/features):\n"
+              << "  FindBestMove (linear)        " << fullLinear << "\n"
+              << "  FindBestMoveBatched (mlp)    " << fullMlp << "\n";
+}
+
+// --- Replay Benchmark ---
+// Plays seeded TetrisGameInstance games, then compares replay size with per-step GetState
+// snapshots and measures sequential decoding and random frame access.
+void BenchmarkReplay(const TetrisEngine::HeuristicWeights& w, uint64_t seed, int games) {
+    std::vector<TetrisEngine::ReplayLog> logs;
+    size_t replayBytes = 0, snapshotBytes = 0, totalMoves = 0;
+    int mismatches = 0;
+
+    for (int g = 0; g < games; ++g) {
+        TetrisEngine::TetrisGameInstance game;
+        game.weights = w;
+        game.Reset(static_cast<uint32_t>(seed + g));
+        for (int step = 0; step < MAX_MOVES_PER_GAME && !game.gameOver; ++step) game.StepAI();
+
+        // Round-trip through the file format and check the last frame against the live game
+        auto bytes = TetrisEngine::Replay::Serialize(game.replay);
+        TetrisEngine::ReplayLog log;
+        TetrisEngine::Replay::Deserialize(bytes.data(), bytes.size(), log);
+        TetrisEngine::Replay::Decoder decoder;
+        decoder.Attach(log);
+        TetrisEngine::Replay::Frame frame;
+        decoder.Seek(decoder.MoveCount(), frame);
+
+        int state[TetrisEngine::BOARD_WIDTH * TetrisEngine::BOARD_HEIGHT];
+        int score, lines, level, next;
+        game.GetState(state, &score, &lines, &level, &next);
+        if (frame.score != score || frame.lines != lines ||
+            !std::equal(state, state + TetrisEngine::BOARD_WIDTH * TetrisEngine::BOARD_HEIGHT, frame.cells))
+            mismatches++;
+
+        replayBytes += bytes.size();
+        snapshotBytes += log.moves.size() * (sizeof(state) + 4 * sizeof(int));
+        totalMoves += log.moves.size();
+        logs.push_back(std::move(log));
+    }
+
+    std::vector<TetrisEngine::Replay::Decoder> decoders(logs.size());
+    auto attachStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < logs.size(); ++i) decoders[i].Attach(logs[i]);
+    double attachSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - attachStart).count();
+
+    volatile int sink = 0;
+    constexpr int REPEAT = 20;
+    auto decodeStart = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < REPEAT; ++rep)
+        for (const auto& d : decoders) sink = sink + d.DecodeAll();
+    double decodeSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - decodeStart).count();
+
+    constexpr int SEEKS = 100000;
+    std::mt19937 rng(static_cast<uint32_t>(seed));
+    TetrisEngine::Replay::Frame frame;
+    auto seekStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < SEEKS; ++i) {
+        const auto& d = decoders[rng() % decoders.size()];
+        d.Seek(static_cast<int>(rng() % (d.MoveCount() + 1)), frame);
+        sink = sink + frame.score;
+    }
+    double seekSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - seekStart).count();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "Games: " << games << ", moves: " << totalMoves << ", final-frame mismatches: " << mismatches << "\n"
+              << "Bytes per game: replay " << static_cast<double>(replayBytes) / games
+              << ", GetState snapshots " << static_cast<double>(snapshotBytes) / games << "\n"
+              << std::setprecision(0)
+              << "Sequential decode: " << (totalMoves * REPEAT) / decodeSec << " moves/s\n"
+              << "Keyframe build:    " << totalMoves / attachSec << " moves/s\n"
+              << "Random seek:       " << SEEKS / seekSec << " frames/s\n";
+}
+
+// --- Profiling Run ---
+// Fixed-seed simulation so per-phase numbers are comparable between builds
+void RunProfile(const TetrisEngine::HeuristicWeights& w, uint64_t seed, int games) {
+    TetrisEngine::Random::Generator().seed(static_cast<uint32_t>(seed));
+    TetrisEngine::Profiler::Reset();
+
+    auto start = std::chrono::steady_clock::now();
+    double lines = 0;
+    for (int i = 0; i < games; ++i) lines += SimulateGame(w);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Seed " << seed << ", " << games << " games, " << lines << " lines, "
+              << std::fixed << std::setprecision(3) << seconds << "s\n";
+    TetrisEngine::Profiler::Dump(std::cout);
 }
 
 // --- CLI ---
@@ -355,11 +635,26 @@ void PrintUsage(const char* programName) {
               << "  --train          Train a new model and save to file\n"
               << "  --play           Load model from file and play (no training)\n"
               << "  --file <path>    Specify weights file (default: tetris_weights.txt)\n"
+              << "  --generate <out> Play games with the loaded model and write a training dataset\n"
+              << "  --games <n>      Games to generate (default: 1000)\n"
+              << "  --threads <n>    Generator threads (default: all cores)\n"
+              << "  --search         Generate with two-piece lookahead instead of greedy moves\n"
+              << "  --seed <n>       Base seed for generated games (default: 1)\n"
+              << "  --inspect <file> Summarize a dataset file\n"
+              << "  --bench-eval     Benchmark linear vs MLP evaluator cost per candidate\n"
+              << "  --mlp <file>     MLP weights for --bench-eval (default: random weights)\n"
+              << "  --profile        Simulate --games games with --seed and print the per-phase breakdown\n"
+              << "                   (probes are compiled in with -DTETRIS_PROFILE)\n"
+              << "  --telemetry <f>  Append per-generation training metrics to <f> as JSON lines\n"
+              << "  --bench-replay   Record --games seeded games and benchmark replay size and decoding\n"
+              << "  --surrogate      Train with a quadratic fitness model that skips children predicted\n"
+              << "                   to be clearly worse than the population (with an exploration quota)\n"
               << "  --help           Show this help message\n\n"
               << "Examples:\n"
               << "  " << programName << "              # Train if needed, then play\n"
               << "  " << programName << " --train      # Train and save only\n"
-              << "  " << programName << " --play       # Load and play only\n";
+              << "  " << programName << " --play       # Load and play only\n"
+              << "  " << programName << " --generate data.bin --games 10000\n";
 }
 
 // --- Main ---
@@ -369,12 +664,33 @@ int main(int argc, char* argv[]) {
     std::string filename = DEFAULT_WEIGHTS_FILE;
     bool trainMode = false;
     bool playMode = false;
+    bool useSearch = false;
+    bool benchEval = false;
+    bool benchReplay = false;
+    bool useSurrogate = false;
+    bool profileMode = false;
+    bool gamesGiven = false;
+    std::string generatePath, inspectPath, mlpFile, telemetryPath;
+    int games = 1000, threads = 0;
+    uint64_t seed = 1;
     
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "--train") trainMode = true;
         else if (arg == "--play") playMode = true;
         else if (arg == "--file" && i + 1 < argc) filename = argv[++i];
+        else if (arg == "--generate" && i + 1 < argc) generatePath = argv[++i];
+        else if (arg == "--inspect" && i + 1 < argc) inspectPath = argv[++i];
+        else if (arg == "--games" && i + 1 < argc) { games = std::atoi(argv[++i]); gamesGiven = true; }
+        else if (arg == "--profile") profileMode = true;
+        else if (arg == "--threads" && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc) seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--search") useSearch = true;
+        else if (arg == "--telemetry" && i + 1 < argc) telemetryPath = argv[++i];
+        else if (arg == "--bench-eval") benchEval = true;
+        else if (arg == "--bench-replay") benchReplay = true;
+        else if (arg == "--surrogate") useSurrogate = true;
+        else if (arg == "--mlp" && i + 1 < argc) mlpFile = argv[++i];
         else if (arg == "--help") {
             PrintUsage(argv[0]);
             return 0;
@@ -392,6 +708,42 @@ int main(int argc, char* argv[]) {
     
     TetrisEngine::HeuristicWeights best;
     
+    TetrisEngine::TelemetrySink telemetry;
+    if (!telemetryPath.empty() && !telemetry.Open(telemetryPath)) {
+        std::cerr << "Warning: Could not open telemetry file " << telemetryPath << "\n";
+    }
+    TetrisEngine::TelemetrySink* sink = telemetry.IsOpen() ? &telemetry : nullptr;
+    
+    if (!inspectPath.empty()) {
+        return InspectDataset(inspectPath) ? 0 : 1;
+    }
+    
+    if (profileMode) {
+        if (!LoadWeights(best, filename)) best = {0.760666, -0.510066, -0.35663, -0.184483};
+        RunProfile(best, seed, gamesGiven ? games : 20);
+        return 0;
+    }
+    
+    if (benchEval) {
+        if (!LoadWeights(best, filename)) best = {0.760666, -0.510066, -0.35663, -0.184483};
+        BenchmarkEvaluators(best, mlpFile);
+        return 0;
+    }
+    
+    if (benchReplay) {
+        if (!LoadWeights(best, filename)) best = {0.760666, -0.510066, -0.35663, -0.184483};
+        BenchmarkReplay(best, seed, gamesGiven ? games : 50);
+        return 0;
+    }
+    
+    if (!generatePath.empty()) {
+        if (!LoadWeights(best, filename)) {
+            std::cerr << "Error: Could not load weights from " << filename << ". Run with --train first.\n";
+            return 1;
+        }
+        return GenerateTrainingData(best, generatePath, games, threads, useSearch, seed) ? 0 : 1;
+    }
+    
     if (playMode) {
         std::cout << "Loading model from " << filename << "...\n";
         if (!LoadWeights(best, filename)) {
@@ -402,7 +754,7 @@ int main(int argc, char* argv[]) {
         PlayVisibleGame(best);
     } else if (trainMode) {
         std::cout << "Training new model...\n";
-        best = RunGeneticAlgorithm();
+        best = RunGeneticAlgorithm(sink, useSurrogate);
         if (SaveWeights(best, filename)) {
             std::cout << "\nModel saved successfully to " << filename << std::endl;
         }
@@ -412,7 +764,7 @@ int main(int argc, char* argv[]) {
             PlayVisibleGame(best);
         } else {
             std::cout << "No saved model found. Training new model...\n";
-            best = RunGeneticAlgorithm();
+            best = RunGeneticAlgorithm(sink, useSurrogate);
             SaveWeights(best, filename);
             std::cout << "\nStarting visual demonstration...\n";
             PlayVisibleGame(best);
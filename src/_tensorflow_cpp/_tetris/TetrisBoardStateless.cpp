@@ -14,6 +14,7 @@
 #include <fstream>
 #include <sstream>
 #include "../include/TetrisEngineStateless.h"
+#include "../include/TetrisPipeline.h"
 
 // For Windows ANSI support
 #ifdef _WIN32
@@ -24,18 +25,6 @@
 // ==================== Graphics & I/O Constants ====================
 constexpr bool USE_FANCY_GRAPHICS = true;
 
-const std::string RESET_COLOR = "\033[0m";
-const std::string EMPTY_COLOR = "\033[1;30m";
-const std::string I_COLOR = "\033[1;36m";
-const std::string O_COLOR = "\033[1;33m";
-const std::string T_COLOR = "\033[1;35m";
-const std::string S_COLOR = "\033[1;32m";
-const std::string Z_COLOR = "\033[1;31m";
-const std::string J_COLOR = "\033[1;34m";
-const std::string L_COLOR = "\033[1;91m";
-const std::string WALL_COLOR = "\033[1;37m";
-const std::string PREVIEW_COLOR = "\033[1;90m";
-
 const std::string DEFAULT_WEIGHTS_FILE = "tetris_weights.txt";
 
 // ==================== Console Setup ====================
@@ -61,99 +50,9 @@ void ClearScreen() {
     std::cout << "\033[2J\033[1;1H";
 }
 
-std::string GetColor(int pieceId) {
-    if (!USE_FANCY_GRAPHICS) return "";
-    switch (pieceId) {
-        case 0: return EMPTY_COLOR;
-        case 1: return I_COLOR;
-        case 2: return O_COLOR;
-        case 3: return T_COLOR;
-        case 4: return S_COLOR;
-        case 5: return Z_COLOR;
-        case 6: return J_COLOR;
-        case 7: return L_COLOR;
-        default: return RESET_COLOR;
-    }
-}
-
-// ==================== Rendering (Stateless) ====================
-void Render(const BoardGrid& grid, int score, int lines, int level, 
-            const Piece* currentPiece = nullptr, int nextPieceId = 0) {
-    BoardGrid tempGrid = grid;
-    
-    if (currentPiece && Engine::IsValid(grid, *currentPiece)) {
-        const auto& shape = currentPiece->GetShape();
-        for (int r = 0; r < 4; ++r) {
-            for (int c = 0; c < 4; ++c) {
-                if (shape[r][c] != 0) {
-                    int py = currentPiece->y + r;
-                    int px = currentPiece->x + c;
-                    if (py >= 0 && py < BOARD_HEIGHT && px >= 0 && px < BOARD_WIDTH) {
-                        tempGrid[py][px] = shape[r][c];
-                    }
-                }
-            }
-        }
-    }
-
-    if (!USE_FANCY_GRAPHICS) {
-        std::cout << "+----------------------+      Next:\n";
-        for (int r = 0; r < BOARD_HEIGHT; ++r) {
-            std::cout << "|";
-            for (int c = 0; c < BOARD_WIDTH; ++c) {
-                std::cout << (tempGrid[r][c] == 0 ? " ." : " #");
-            }
-            std::cout << " |";
-            
-            if (r >= 2 && r <= 5 && nextPieceId > 0) {
-                const auto& nextShape = TETROMINO_SHAPES[nextPieceId - 1][0];
-                int previewRow = r - 2;
-                std::cout << "      ";
-                for (int c = 0; c < 4; ++c) {
-                    std::cout << (nextShape[previewRow][c] != 0 ? "# " : "  ");
-                }
-            } else if (r == 1) {
-                std::cout << "      ----";
-            } else if (r == 0) {
-                std::cout << "      Next";
-            }
-            
-            if (r == 7) std::cout << "  Score: " << score;
-            if (r == 9) std::cout << "  Lines: " << lines;
-            if (r == 11) std::cout << "  Level: " << level;
-            std::cout << "\n";
-        }
-        std::cout << "+----------------------+\n";
-        return;
-    }
-
-    std::cout << WALL_COLOR << "╔═════════════════════╗" << PREVIEW_COLOR << "     " << RESET_COLOR << "\n";
-    for (int r = 0; r < BOARD_HEIGHT; ++r) {
-        std::cout << WALL_COLOR << "║" << RESET_COLOR;
-        for (int c = 0; c < BOARD_WIDTH; ++c) {
-            std::cout << (tempGrid[r][c] == 0 ? EMPTY_COLOR + " ." + RESET_COLOR : GetColor(tempGrid[r][c]) + " ■" + RESET_COLOR);
-        }
-        std::cout << WALL_COLOR << " ║" << RESET_COLOR;
-        
-        if (r >= 2 && r <= 5 && nextPieceId > 0) {
-            const auto& nextShape = TETROMINO_SHAPES[nextPieceId - 1][0];
-            int previewRow = r - 2;
-            std::cout << PREVIEW_COLOR << "      " << RESET_COLOR;
-            for (int c = 0; c < 4; ++c) {
-                std::cout << (nextShape[previewRow][c] != 0 ? GetColor(nextShape[previewRow][c]) + "■ " + RESET_COLOR : "  ");
-            }
-        } else if (r == 1) {
-            std::cout << PREVIEW_COLOR << "      ────" << RESET_COLOR;
-        } else if (r == 0) {
-            std::cout << PREVIEW_COLOR << "      Next" << RESET_COLOR;
-        }
-        
-        if (r == 7) std::cout << "  Score: " << score;
-        if (r == 9) std::cout << "  Lines: " << lines;
-        if (r == 11) std::cout << "  Level: " << level;
-        std::cout << "\n";
-    }
-    std::cout << WALL_COLOR << "╚═════════════════════╝" << RESET_COLOR << "\n";
+TetrisConsole::FrameRenderer& Renderer() {
+    static TetrisConsole::FrameRenderer renderer(USE_FANCY_GRAPHICS);
+    return renderer;
 }
 
 // ==================== File I/O ====================
@@ -180,63 +79,43 @@ bool LoadWeights(HeuristicWeights& w, const std::string& filename) {
 }
 
 // ==================== Visual Game Play (State Managed Here) ====================
+// Adapter for TetrisConsole::SimulateGame; the game state is held here, not in an object
+struct VisibleGameEngine {
+    BoardGrid grid = {};
+    const HeuristicWeights& w;
+
+    int RandomPiece() { return Engine::Random::Int(1, 7); }
+    bool IsGameOver(int piece) { return Engine::IsGameOver(grid, {piece, 0, 3, 0}); }
+    void BestMove(int piece, int& rotation, int& x) {
+        Move m = Engine::FindBestMove(grid, piece, w);
+        rotation = m.rotation;
+        x = m.x;
+    }
+    bool IsValid(int piece, int rotation, int x, int y) { return Engine::IsValid(grid, {piece, rotation, x, y}); }
+    int Lock(int piece, int rotation, int x, int y) {
+        grid = Engine::PlacePiece(grid, {piece, rotation, x, y}); // State updated here
+        return Engine::ClearLines(grid);
+    }
+};
+
+// Simulation runs on its own thread and streams events; this thread only renders
 void PlayVisibleGame(const HeuristicWeights& w) {
-    ClearScreen();
-    BoardGrid grid = {}; // Game state held here, not in an object
-    int score = 0, lines = 0, level = 1;
-    int nextPieceId = Engine::Random::Int(1, 7);
-    bool over = false;
+    TetrisConsole::EventRing ring;
+
+    std::thread simulation([&ring, &w] {
+        VisibleGameEngine engine{{}, w};
+        TetrisConsole::SimulateGame(engine, ring);
+    });
+
+    Renderer().Invalidate();
+    TetrisConsole::PlaybackRenderer playback(Renderer(), TETROMINO_SHAPES);
+    auto stats = playback.Run(ring);
+    simulation.join();
 
-    std::cout << "--- AI Playing Tetris ---\n";
-    
-    while (!over) {
-        int currentPieceId = nextPieceId;
-        nextPieceId = Engine::Random::Int(1, 7);
-        Piece p{currentPieceId, 0, 3, 0};
-        
-        if (Engine::IsGameOver(grid, p)) { over = true; break; }
-        
-        // Preview initial position
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
-        Render(grid, score, lines, level, &p, nextPieceId);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        
-        // Find and execute best move
-        Move m = Engine::FindBestMove(grid, currentPieceId, w);
-        p.rotation = m.rotation; p.x = m.x;
-        
-        int y = 0;
-        while (!Engine::IsValid(grid, {currentPieceId, m.rotation, m.x, y})) y--;
-        int finalY = y;
-        while (Engine::IsValid(grid, {currentPieceId, m.rotation, m.x, finalY + 1})) finalY++;
-        
-        // Animation
-        for (int dropY = y; dropY <= finalY; ++dropY) {
-            p.y = dropY;
-            ClearScreen();
-            std::cout << "--- AI Playing ---\n";
-            Render(grid, score, lines, level, &p, nextPieceId);
-            std::this_thread::sleep_for(std::chrono::milliseconds(30));
-        }
-        
-        p.y = finalY;
-        grid = Engine::PlacePiece(grid, p); // State updated here
-        int cleared = Engine::ClearLines(grid);
-        if (cleared) {
-            lines += cleared;
-            score += cleared * cleared * 100 * level;
-            level = 1 + (lines / 10);
-        }
-        
-        // Show final state
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
-        Render(grid, score, lines, level, nullptr, nextPieceId);
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
-    }
     ClearScreen();
-    std::cout << "--- GAME OVER ---\nFinal Score: " << score << "\nFinal Lines: " << lines << "\n";
+    std::cout << "--- GAME OVER ---\nFinal Score: " << playback.Score() << "\nFinal Lines: " << playback.Lines() << "\n"
+              << "Frames shown: " << stats.framesShown << ", dropped: " << stats.framesDropped
+              << ", max backlog: " << stats.maxBacklog << " events\n";
 }
 
 // ==================== Command Line Interface ====================
@@ -0,0 +1,189 @@
+/*
+TETRIS ENGINE - C ABI (TetrisEngine.dll)
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -shared -m64 -o "__dist/TetrisEngine.dll" "_tetris/TetrisEngine.cpp" -Wl,--subsystem,windows
+
+Linux / macOS:
+
+g++ -std=c++20 -O2 -shared -fPIC -fvisibility=hidden -o __dist/libTetrisEngine.so _tetris/TetrisEngine.cpp -pthread
+
+Entry points are declared in include/TetrisEngineAPI.h.
+*/
+
+#include "../include/TetrisEngineAPI.h"
+#include "../include/TetrisEngine.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+static_assert(sizeof(TetrisStateExport) == sizeof(TetrisEngine::StateExport) &&
+              offsetof(TetrisStateExport, stats) == offsetof(TetrisEngine::StateExport, stats) &&
+              offsetof(TetrisStateExport, cells) == offsetof(TetrisEngine::StateExport, cells) &&
+              sizeof(TetrisGameStats) == sizeof(TetrisEngine::ExportStats),
+              "TetrisStateExport must mirror TetrisEngine::StateExport");
+
+namespace {
+
+constexpr int DEFAULT_MAX_MOVES = 500;
+const TetrisEngine::HeuristicWeights DEFAULT_WEIGHTS{0.760666, -0.510066, -0.35663, -0.184483};
+
+TetrisEngine::TetrisGameInstance* AsGame(TETRIS_Instance game) {
+    return static_cast<TetrisEngine::TetrisGameInstance*>(game);
+}
+
+void FillStats(const TetrisEngine::TetrisGameInstance& g, TetrisGameStats* stats) {
+    stats->score = g.score;
+    stats->lines = g.lines;
+    stats->level = g.level;
+    stats->moves = static_cast<int32_t>(g.replay.moves.size());
+    stats->next = g.nextPiece;
+    stats->gameOver = g.gameOver ? 1 : 0;
+}
+
+// Cells covered by the spawn probe used by TetrisGameInstance::EvaluateBoard ({1, 0, 3, 0})
+struct SpawnMask {
+    int cells[4];
+    int count = 0;
+
+    SpawnMask() {
+        TetrisEngine::Piece probe{1, 0, 3, 0};
+        const auto& shape = probe.GetShape();
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                if (shape[r][c] && count < 4) cells[count++] = (probe.y + r) * TetrisEngine::BOARD_WIDTH + probe.x + c;
+    }
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////
+// INSTANCES
+/////////////////////////////////////////////////////////////////////
+
+TETRIS_API TETRIS_Instance CreateGame(uint32_t seed) {
+    auto* g = new TetrisEngine::TetrisGameInstance(seed);
+    g->weights = DEFAULT_WEIGHTS;
+    return g;
+}
+
+TETRIS_API void DestroyGame(TETRIS_Instance game) {
+    delete AsGame(game);
+}
+
+TETRIS_API void ResetGame(TETRIS_Instance game, uint32_t seed) {
+    if (game) AsGame(game)->Reset(seed);
+}
+
+TETRIS_API void SetGameWeights(TETRIS_Instance game, const double* weights) {
+    if (!game || !weights) return;
+    AsGame(game)->weights = {weights[0], weights[1], weights[2], weights[3]};
+}
+
+TETRIS_API int LoadGameModel(TETRIS_Instance game, const char* filename) {
+    return game && filename && AsGame(game)->LoadModel(filename) ? 1 : 0;
+}
+
+TETRIS_API int StepAI(TETRIS_Instance game) {
+    return StepAIMany(game, 1);
+}
+
+TETRIS_API int StepAIMany(TETRIS_Instance game, int steps) {
+    if (!game) return 0;
+    auto* g = AsGame(game);
+    size_t before = g->replay.moves.size();
+    for (int i = 0; i < steps && !g->gameOver; ++i) g->StepAI();
+    return static_cast<int>(g->replay.moves.size() - before);
+}
+
+TETRIS_API void GetGameState(TETRIS_Instance game, int* board, TetrisGameStats* stats) {
+    if (!game) return;
+    auto* g = AsGame(game);
+    if (board) {
+        const auto& grid = g->board.GetGrid();
+        for (int r = 0; r < TetrisEngine::BOARD_HEIGHT; ++r)
+            std::copy(grid[r].begin(), grid[r].end(), board + r * TetrisEngine::BOARD_WIDTH);
+    }
+    if (stats) FillStats(*g, stats);
+}
+
+/////////////////////////////////////////////////////////////////////
+// POLLING
+/////////////////////////////////////////////////////////////////////
+
+TETRIS_API const TetrisStateExport* GetGameExport(TETRIS_Instance game) {
+    return game ? reinterpret_cast<const TetrisStateExport*>(&AsGame(game)->exported) : nullptr;
+}
+
+TETRIS_API int PollGameState(TETRIS_Instance game, uint64_t* version, uint8_t* board, TetrisGameStats* stats) {
+    if (!game || !version) return 0;
+    TetrisEngine::ExportStats s;
+    uint64_t read = TetrisEngine::ReadStateExport(AsGame(game)->exported, *version, board, &s);
+    if (read == *version) return 0;
+    *version = read;
+    if (stats) std::memcpy(stats, &s, sizeof(s));
+    return 1;
+}
+
+TETRIS_API int PollGames(const TETRIS_Instance* games, int n, uint64_t* versions, uint8_t* boards,
+                         TetrisGameStats* stats) {
+    if (!games || !versions || n <= 0) return 0;
+    constexpr int CELLS = TetrisEngine::BOARD_WIDTH * TetrisEngine::BOARD_HEIGHT;
+    int changed = 0;
+    for (int i = 0; i < n; ++i) {
+        changed += PollGameState(games[i], &versions[i], boards ? boards + static_cast<size_t>(i) * CELLS : nullptr,
+                                 stats ? &stats[i] : nullptr);
+    }
+    return changed;
+}
+
+/////////////////////////////////////////////////////////////////////
+// BATCHES
+/////////////////////////////////////////////////////////////////////
+
+TETRIS_API void RunGames(const double* weights, const uint32_t* seeds, int count, int maxMoves,
+                         TetrisGameStats* out_stats) {
+    if (!seeds || !out_stats || count <= 0) return;
+    TetrisEngine::HeuristicWeights w = weights
+        ? TetrisEngine::HeuristicWeights{weights[0], weights[1], weights[2], weights[3]}
+        : DEFAULT_WEIGHTS;
+    int limit = maxMoves > 0 ? maxMoves : DEFAULT_MAX_MOVES;
+
+    // Games are claimed one at a time so long and short games balance across workers
+    std::atomic<int> nextGame{0};
+    auto worker = [&] {
+        TetrisEngine::TetrisGameInstance g(seeds[0]);
+        g.weights = w;
+        for (int i = nextGame.fetch_add(1); i < count; i = nextGame.fetch_add(1)) {
+            g.Reset(seeds[i]);
+            for (int m = 0; m < limit && !g.gameOver; ++m) g.StepAI();
+            FillStats(g, &out_stats[i]);
+        }
+    };
+
+    int workers = std::min(count, std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+    std::vector<std::thread> threads;
+    for (int t = 1; t < workers; ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+}
+
+TETRIS_API int EvaluateBoards(const int8_t* boards, int n, uint8_t* out) {
+    if (!boards || !out || n <= 0) return 0;
+    static const SpawnMask mask;
+    constexpr int CELLS = TetrisEngine::BOARD_WIDTH * TetrisEngine::BOARD_HEIGHT;
+
+    int over = 0;
+    for (int i = 0; i < n; ++i) {
+        const int8_t* b = boards + static_cast<size_t>(i) * CELLS;
+        uint8_t blocked = 0;
+        for (int k = 0; k < mask.count; ++k) blocked |= b[mask.cells[k]] != 0;
+        out[i] = blocked;
+        over += blocked;
+    }
+    return over;
+}
@@ -0,0 +1,190 @@
+/*
+TETRIS ENGINE C ABI - PER-STEP VS BATCHED CALL PATTERNS
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o "__test/TetrisEngineBench.exe" "_tetris/TetrisEngineBench.cpp" "_tetris/TetrisEngine.cpp"
+
+Every exported call from a managed host pays a fixed marshalling cost, so besides raw
+throughput this reports how many ABI calls each pattern needs per unit of work.
+
+The polling section mimics a frontend refreshing --instances games once per frame while
+about a quarter of them place a piece between frames: full GetGameState copies against
+PollGames, which skips unchanged instances and copies only dirty rows.
+*/
+
+#include "../include/TetrisEngineAPI.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr int CELLS = 200;
+
+struct Result {
+    double seconds = 0.0;
+    long long calls = 0;
+    long long work = 0;  // steps, games or boards
+};
+
+void Report(const char* name, const char* unit, const Result& r) {
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << r.work / r.seconds << " " << std::left << std::setw(8) << (std::string(unit) + "/s") << std::right
+              << std::setw(12) << r.calls / r.seconds << " calls/s"
+              << std::setprecision(3) << std::setw(10) << static_cast<double>(r.calls) / r.work << " calls/" << unit
+              << "\n";
+}
+
+template <typename Fn>
+Result Time(Fn&& fn) {
+    Result r;
+    auto start = std::chrono::steady_clock::now();
+    fn(r);
+    r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return r;
+}
+
+int main(int argc, char* argv[]) {
+    int games = 40;
+    int boards = 200000;
+    int instances = 48, frames = 600;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc) games = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--boards" && i + 1 < argc) boards = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--instances" && i + 1 < argc) instances = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--frames" && i + 1 < argc) frames = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--games <n>] [--boards <n>] [--instances <n>] [--frames <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    constexpr int MAX_MOVES = 500;
+    std::vector<uint32_t> seeds(games);
+    for (int i = 0; i < games; ++i) seeds[i] = 1000u + i;
+    int state[CELLS];
+    TetrisGameStats stats;
+
+    // 1. Host drives every step and polls the state after each one
+    Result perStep = Time([&](Result& r) {
+        for (uint32_t seed : seeds) {
+            TETRIS_Instance g = CreateGame(seed);
+            r.calls++;
+            for (int m = 0; m < MAX_MOVES; ++m) {
+                int placed = StepAI(g);
+                GetGameState(g, state, &stats);
+                r.calls += 2;
+                r.work += placed;
+                if (stats.gameOver) break;
+            }
+            DestroyGame(g);
+            r.calls++;
+        }
+    });
+
+    // 2. One call advances a whole game, one call reads the result
+    Result batched = Time([&](Result& r) {
+        for (uint32_t seed : seeds) {
+            TETRIS_Instance g = CreateGame(seed);
+            r.work += StepAIMany(g, MAX_MOVES);
+            GetGameState(g, state, &stats);
+            DestroyGame(g);
+            r.calls += 4;
+        }
+    });
+
+    // 3. All games in a single call, spread across cores
+    std::vector<TetrisGameStats> out(games);
+    Result runGames = Time([&](Result& r) {
+        RunGames(nullptr, seeds.data(), games, MAX_MOVES, out.data());
+        r.calls = 1;
+        for (const auto& s : out) r.work += s.moves;
+    });
+
+    // Boards: random fill with a varying top region so both outcomes occur
+    std::mt19937 rng(7);
+    std::vector<int8_t> boardData(static_cast<size_t>(boards) * CELLS);
+    for (int b = 0; b < boards; ++b) {
+        int top = static_cast<int>(rng() % 22);
+        for (int c = 0; c < CELLS; ++c)
+            boardData[static_cast<size_t>(b) * CELLS + c] = (c / 10 >= top && rng() % 3) ? static_cast<int8_t>(1 + rng() % 7) : 0;
+    }
+    std::vector<uint8_t> flags(boards);
+
+    Result perBoard = Time([&](Result& r) {
+        for (int b = 0; b < boards; ++b) EvaluateBoards(boardData.data() + static_cast<size_t>(b) * CELLS, 1, &flags[b]);
+        r.calls = boards;
+        r.work = boards;
+    });
+    int overPerBoard = 0;
+    for (uint8_t f : flags) overPerBoard += f;
+
+    int overBatched = 0;
+    Result batchBoards = Time([&](Result& r) {
+        overBatched = EvaluateBoards(boardData.data(), boards, flags.data());
+        r.calls = 1;
+        r.work = boards;
+    });
+
+    // Polling: only the poll calls are timed, stepping between frames is not
+    std::vector<TETRIS_Instance> live(instances);
+    for (int i = 0; i < instances; ++i) live[i] = CreateGame(5000u + i);
+    std::vector<int> fullBoards(static_cast<size_t>(instances) * CELLS);
+    std::vector<uint8_t> polledBoards(static_cast<size_t>(instances) * CELLS);
+    std::vector<uint64_t> versions(instances, 0);
+    std::vector<TetrisGameStats> fullStats(instances), polledStats(instances);
+    long long fullBytes = 0, polledRowsCopied = 0, pollChanged = 0, pollMismatches = 0;
+    double fullSec = 0.0, pollSec = 0.0;
+    std::mt19937 pick(11);
+
+    for (int f = 0; f < frames; ++f) {
+        for (int i = 0; i < instances; ++i) {
+            if (pick() % 4 == 0 && StepAI(live[i]) == 0) ResetGame(live[i], pick());
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < instances; ++i) GetGameState(live[i], fullBoards.data() + static_cast<size_t>(i) * CELLS, &fullStats[i]);
+        auto t1 = std::chrono::steady_clock::now();
+        std::vector<uint64_t> before = versions;
+        pollChanged += PollGames(live.data(), instances, versions.data(), polledBoards.data(), polledStats.data());
+        auto t2 = std::chrono::steady_clock::now();
+        fullSec += std::chrono::duration<double>(t1 - t0).count();
+        pollSec += std::chrono::duration<double>(t2 - t1).count();
+        fullBytes += static_cast<long long>(instances) * (CELLS * sizeof(int) + sizeof(TetrisGameStats));
+
+        for (int i = 0; i < instances; ++i) {
+            const TetrisStateExport* e = GetGameExport(live[i]);
+            for (int r = 0; r < 20; ++r) polledRowsCopied += before[i] != versions[i] && e->rowVersion[r] > before[i];
+            for (int c = 0; c < CELLS; ++c)
+                pollMismatches += polledBoards[static_cast<size_t>(i) * CELLS + c] != fullBoards[static_cast<size_t>(i) * CELLS + c];
+            pollMismatches += std::memcmp(&polledStats[i], &fullStats[i], sizeof(TetrisGameStats)) != 0;
+        }
+    }
+    for (auto g : live) DestroyGame(g);
+    long long polledBytes = polledRowsCopied * 10 + pollChanged * static_cast<long long>(sizeof(TetrisGameStats));
+
+    std::cout << "Games: " << games << " (max " << MAX_MOVES << " moves), boards: " << boards << "\n\n";
+    Report("StepAI + GetGameState", "step", perStep);
+    Report("StepAIMany", "step", batched);
+    Report("RunGames", "step", runGames);
+    Report("EvaluateBoards (n = 1)", "board", perBoard);
+    Report("EvaluateBoards (batched)", "board", batchBoards);
+
+    long long lines = 0;
+    for (const auto& s : out) lines += s.lines;
+    std::cout << "\nPolling " << instances << " instances x " << frames << " frames:\n" << std::setprecision(2)
+              << "  GetGameState  " << fullSec * 1e6 / frames << " us/frame, " << fullBytes / frames << " bytes/frame\n"
+              << "  PollGames     " << pollSec * 1e6 / frames << " us/frame, " << polledBytes / frames << " bytes/frame, "
+              << static_cast<double>(pollChanged) / frames << " changed instances/frame"
+              << (pollMismatches ? " (MISMATCH)" : " (matches GetGameState)") << "\n";
+
+    std::cout << "\nRunGames lines: " << lines << ", game-over boards: " << overBatched
+              << (overBatched == overPerBoard ? " (matches per-board)" : " (MISMATCH)") << "\n";
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+TETRIS AI SERVICE - LOAD GENERATOR (Linux)
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o __test/TetrisLoadGen _tetris/TetrisLoadGen.cpp -pthread
+
+Run against a started __test/TetrisServer:
+
+__test/TetrisLoadGen [--socket /tmp/tetris_ai.sock] [--connections 4] [--depth 32] [--requests 200000] [--verify]
+
+Each connection keeps 'depth' requests in flight (pipelined) and refills as responses
+arrive. Latency is measured per request from the write that carried it to the read that
+returned its response.
+*/
+
+#ifndef __linux__
+#error "TetrisLoadGen needs Unix domain sockets (Linux)"
+#endif
+
+#include "../include/TetrisBitboard.h"
+#include "../include/TetrisProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using TetrisEngine::Protocol::MoveRequest;
+using TetrisEngine::Protocol::MoveResponse;
+using Clock = std::chrono::steady_clock;
+
+struct Position {
+    uint8_t board[TetrisEngine::BOARD_PACKED_BYTES];
+    int piece;
+};
+
+// Realistic mid-game positions from seeded heuristic play
+std::vector<Position> CollectPositions(const TetrisEngine::HeuristicWeights& w, int count) {
+    std::vector<Position> positions;
+    std::mt19937 rng(4242);
+    TetrisEngine::BoardEngine board;
+    while (static_cast<int>(positions.size()) < count) {
+        int piece = static_cast<int>(rng() % 7) + 1;
+        if (board.IsGameOver({piece, 0, 3, 0})) { board.Reset(); continue; }
+        Position p;
+        board.PackBits(p.board);
+        p.piece = piece;
+        positions.push_back(p);
+
+        auto m = TetrisEngine::FindBestMove(board, piece, w);
+        TetrisEngine::Piece placed{piece, m.rotation, m.x, 0};
+        while (!board.IsValid(placed)) placed.y--;
+        while (board.IsValid({piece, m.rotation, m.x, placed.y + 1})) placed.y++;
+        board.PlacePiece(placed);
+        board.ClearLines();
+    }
+    return positions;
+}
+
+int Connect(const std::string& path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool WriteAll(int fd, const void* data, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+struct ConnectionResult {
+    std::vector<double> latenciesUs;
+    uint64_t mismatches = 0;
+    bool failed = false;
+};
+
+void RunConnection(const std::string& path, const std::vector<Position>& positions, int requests, int depth,
+                   const std::vector<TetrisEngine::Move>* expected, int offset, ConnectionResult& result) {
+    int fd = Connect(path);
+    if (fd < 0) { result.failed = true; return; }
+
+    std::vector<Clock::time_point> sentAt(requests);
+    result.latenciesUs.reserve(requests);
+    int sent = 0, received = 0;
+    std::vector<MoveRequest> batch;
+    batch.reserve(depth);
+
+    auto send = [&](int n) {
+        batch.clear();
+        for (int i = 0; i < n && sent < requests; ++i, ++sent) {
+            const Position& p = positions[(offset + sent) % positions.size()];
+            MoveRequest req{};
+            req.id = static_cast<uint32_t>(sent);
+            req.piece = static_cast<uint8_t>(p.piece);
+            std::memcpy(req.board, p.board, sizeof(req.board));
+            batch.push_back(req);
+        }
+        auto now = Clock::now();
+        for (const auto& req : batch) sentAt[req.id] = now;
+        return batch.empty() || WriteAll(fd, batch.data(), batch.size() * sizeof(MoveRequest));
+    };
+
+    if (!send(depth)) { result.failed = true; close(fd); return; }
+
+    std::vector<uint8_t> buf(64 * 1024);
+    size_t have = 0;
+    while (received < requests) {
+        ssize_t n = read(fd, buf.data() + have, buf.size() - have);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) { result.failed = true; break; }
+        have += static_cast<size_t>(n);
+
+        auto now = Clock::now();
+        size_t count = have / sizeof(MoveResponse);
+        for (size_t i = 0; i < count; ++i) {
+            MoveResponse res;
+            std::memcpy(&res, buf.data() + i * sizeof(MoveResponse), sizeof(res));
+            result.latenciesUs.push_back(std::chrono::duration<double, std::micro>(now - sentAt[res.id]).count());
+            if (expected) {
+                const auto& e = (*expected)[(offset + res.id) % positions.size()];
+                if (res.status != TetrisEngine::Protocol::STATUS_OK || res.rotation != e.rotation || res.x != e.x)
+                    result.mismatches++;
+            }
+        }
+        received += static_cast<int>(count);
+        std::memmove(buf.data(), buf.data() + count * sizeof(MoveResponse), have - count * sizeof(MoveResponse));
+        have -= count * sizeof(MoveResponse);
+
+        if (!send(static_cast<int>(count))) { result.failed = true; break; }
+    }
+    close(fd);
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = TetrisEngine::Protocol::DEFAULT_SOCKET_PATH;
+    int connections = 4, depth = 32, requests = 200000;
+    bool verify = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) path = argv[++i];
+        else if (arg == "--connections" && i + 1 < argc) connections = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--depth" && i + 1 < argc) depth = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--requests" && i + 1 < argc) requests = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--verify") verify = true;
+        else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--socket <path>] [--connections <n>] [--depth <n>] [--requests <n>] [--verify]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    TetrisEngine::HeuristicWeights w{0.760666, -0.510066, -0.35663, -0.184483};
+    auto positions = CollectPositions(w, 4096);
+    std::vector<TetrisEngine::Move> expected;
+    if (verify) {
+        // Only meaningful when the server runs with the same (default) weights
+        for (const auto& p : positions) {
+            TetrisEngine::BoardEngine b;
+            b.LoadFromBits(p.board);
+            expected.push_back(TetrisEngine::FindBestMove(b, p.piece, w));
+        }
+    }
+
+    // The first requests % connections connections take one extra request, so all are sent
+    std::vector<ConnectionResult> results(connections);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (int c = 0; c < connections; ++c) {
+        int perConnection = requests / connections + (c < requests % connections ? 1 : 0);
+        threads.emplace_back(RunConnection, std::cref(path), std::cref(positions), perConnection, depth,
+                             verify ? &expected : nullptr, c * 997, std::ref(results[c]));
+    }
+    for (auto& t : threads) t.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> all;
+    uint64_t mismatches = 0;
+    for (const auto& r : results) {
+        if (r.failed) {
+            std::cerr << "Connection failed (is the server running on " << path << "?)\n";
+            return 1;
+        }
+        all.insert(all.end(), r.latenciesUs.begin(), r.latenciesUs.end());
+        mismatches += r.mismatches;
+    }
+    std::sort(all.begin(), all.end());
+    auto pct = [&](double q) { return all[static_cast<size_t>(q * (all.size() - 1))]; };
+
+    std::cout << std::fixed << std::setprecision(0)
+              << "Requests: " << all.size() << " over " << connections << " connections, depth " << depth << "\n"
+              << "Throughput: " << all.size() / seconds << " moves/s\n"
+              << std::setprecision(1)
+              << "Latency: p50 " << pct(0.50) << "us, p99 " << pct(0.99) << "us, max " << all.back() << "us\n";
+    if (verify) std::cout << "Mismatches vs local FindBestMove: " << mismatches << "\n";
+    return 0;
+}
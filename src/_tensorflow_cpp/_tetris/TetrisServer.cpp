@@ -0,0 +1,406 @@
+/*
+TETRIS AI SERVICE - UNIX DOMAIN SOCKET + EPOLL (Linux)
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o __test/TetrisServer _tetris/TetrisServer.cpp -pthread
+
+Run:
+
+__test/TetrisServer [--socket /tmp/tetris_ai.sock] [--workers n] [--file tetris_weights.txt]
+
+One epoll thread owns every socket. Each read turns all complete requests in the
+connection buffer into a batch; batches are split into chunks for the worker pool,
+and workers hand finished responses back through a completion queue + eventfd. A
+connection with MAX_IN_FLIGHT requests unanswered or MAX_PENDING_OUTPUT bytes unsent
+is not read until it drains. A client may shut down its write side after the last
+request; it still gets every response before the server closes. The protocol is
+described in include/TetrisProtocol.h; _tetris/TetrisLoadGen.cpp drives it.
+*/
+
+#ifndef __linux__
+#error "TetrisServer needs epoll/eventfd (Linux)"
+#endif
+
+#include "../include/TetrisBitboard.h"
+#include "../include/TetrisProtocol.h"
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using TetrisEngine::Protocol::MoveRequest;
+using TetrisEngine::Protocol::MoveResponse;
+
+constexpr size_t CHUNK_REQUESTS = 64;     // requests per worker job
+constexpr size_t READ_BUFFER = 64 * 1024;
+// Back-pressure: a connection is not read while either limit is reached
+constexpr size_t MAX_IN_FLIGHT = 4096;            // requests queued or being solved
+constexpr size_t MAX_PENDING_OUTPUT = 1 << 20;    // unsent response bytes
+
+std::atomic<bool> g_stop{false};
+
+// --- Jobs ---
+struct Job {
+    uint64_t conn;                        // connection serial, not fd (fds are reused)
+    std::vector<MoveRequest> requests;
+};
+
+struct Completion {
+    uint64_t conn;
+    std::vector<MoveResponse> responses;
+};
+
+MoveResponse Solve(const MoveRequest& req, const TetrisEngine::HeuristicWeights& w) {
+    MoveResponse res{};
+    res.id = req.id;
+    if (req.piece < 1 || req.piece > 7) {
+        res.status = TetrisEngine::Protocol::STATUS_BAD_PIECE;
+        return res;
+    }
+    TetrisEngine::Bitboard board = TetrisEngine::Bitboard::FromBits(req.board);
+    if (board.IsGameOver(req.piece)) {
+        res.status = TetrisEngine::Protocol::STATUS_GAME_OVER;
+        return res;
+    }
+    int evaluated = 0;
+    TetrisEngine::Move m = TetrisEngine::FindBestMove(board, req.piece, w, &evaluated);
+    res.rotation = static_cast<int8_t>(m.rotation);
+    res.x = static_cast<int8_t>(m.x);
+    res.y = static_cast<int8_t>(board.DropY(req.piece, m.rotation, m.x));
+    res.score = static_cast<float>(m.score);
+    res.evaluated = static_cast<uint32_t>(evaluated);
+    res.status = TetrisEngine::Protocol::STATUS_OK;
+    return res;
+}
+
+class WorkerPool {
+public:
+    WorkerPool(int workers, const TetrisEngine::HeuristicWeights& w, int wakeFd) : weights(w), wakeFd(wakeFd) {
+        for (int i = 0; i < workers; ++i) threads.emplace_back(&WorkerPool::Run, this);
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            stopping = true;
+        }
+        jobReady.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    void Submit(Job job) {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            jobs.push_back(std::move(job));
+        }
+        jobReady.notify_one();
+    }
+
+    std::deque<Completion> TakeCompletions() {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        std::deque<Completion> out;
+        out.swap(done);
+        return out;
+    }
+
+private:
+    void Run() {
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(jobMutex);
+                jobReady.wait(lock, [&] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+
+            Completion c{job.conn, {}};
+            c.responses.reserve(job.requests.size());
+            for (const auto& req : job.requests) c.responses.push_back(Solve(req, weights));
+
+            bool wasEmpty;
+            {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                wasEmpty = done.empty();
+                done.push_back(std::move(c));
+            }
+            // One wakeup per drain of the completion queue, not per job
+            if (wasEmpty) {
+                uint64_t one = 1;
+                ssize_t n = write(wakeFd, &one, sizeof(one));
+                (void)n;
+            }
+        }
+    }
+
+    TetrisEngine::HeuristicWeights weights;
+    int wakeFd;
+    std::vector<std::thread> threads;
+    std::mutex jobMutex;
+    std::condition_variable jobReady;
+    std::deque<Job> jobs;
+    bool stopping = false;
+    std::mutex doneMutex;
+    std::deque<Completion> done;
+};
+
+// --- Connections ---
+struct Connection {
+    int fd = -1;
+    uint64_t serial = 0;
+    std::vector<uint8_t> in;
+    std::vector<uint8_t> out;
+    size_t outOffset = 0;
+    size_t inFlight = 0;       // requests handed to the workers, not yet answered
+    bool readClosed = false;   // peer shut down its write side; answer what's left, then close
+    uint32_t watched = 0;      // epoll events currently registered
+
+    bool Throttled() const {
+        return inFlight >= MAX_IN_FLIGHT || out.size() - outOffset >= MAX_PENDING_OUTPUT;
+    }
+};
+
+bool SetNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+class Server {
+public:
+    Server(const std::string& path, int workers, const TetrisEngine::HeuristicWeights& w)
+        : socketPath(path), workerCount(workers), weights(w) {}
+
+    int Run() {
+        listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0) { perror("socket"); return 1; }
+
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "Socket path too long: " << socketPath << "\n";
+            return 1;
+        }
+        std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(socketPath.c_str());
+        if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) { perror("bind"); return 1; }
+        if (listen(listenFd, 128) < 0) { perror("listen"); return 1; }
+        SetNonBlocking(listenFd);
+
+        epollFd = epoll_create1(0);
+        wakeFd = eventfd(0, EFD_NONBLOCK);
+        if (epollFd < 0 || wakeFd < 0) { perror("epoll/eventfd"); return 1; }
+        Watch(listenFd, EPOLLIN, LISTEN_TAG);
+        Watch(wakeFd, EPOLLIN, WAKE_TAG);
+
+        auto pool = std::make_unique<WorkerPool>(workerCount, weights, wakeFd);
+        workersPtr = pool.get();
+        std::cout << "Tetris AI server listening on " << socketPath << " (" << workerCount << " workers)\n";
+
+        epoll_event events[64];
+        while (!g_stop.load()) {
+            int n = epoll_wait(epollFd, events, 64, 200);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                perror("epoll_wait");
+                break;
+            }
+            for (int i = 0; i < n; ++i) {
+                uint64_t tag = events[i].data.u64;
+                if (tag == LISTEN_TAG) Accept();
+                else if (tag == WAKE_TAG) DrainCompletions();
+                else HandleConnection(tag, events[i].events);
+            }
+        }
+
+        pool.reset(); // joins workers before the eventfd they signal is closed
+        workersPtr = nullptr;
+        for (auto& [serial, c] : conns) close(c.fd);
+        conns.clear();
+        close(wakeFd);
+        close(epollFd);
+        close(listenFd);
+        unlink(socketPath.c_str());
+        std::cout << "Served " << served << " requests\n";
+        return 0;
+    }
+
+private:
+    static constexpr uint64_t LISTEN_TAG = 0;
+    static constexpr uint64_t WAKE_TAG = 1;
+
+    void Watch(int fd, uint32_t events, uint64_t tag, int op = EPOLL_CTL_ADD) {
+        epoll_event ev{};
+        ev.events = events;
+        ev.data.u64 = tag;
+        epoll_ctl(epollFd, op, fd, &ev);
+    }
+
+    void Accept() {
+        for (;;) {
+            int fd = accept(listenFd, nullptr, nullptr);
+            if (fd < 0) return;
+            SetNonBlocking(fd);
+            uint64_t serial = nextSerial++;
+            Connection& c = conns[serial];
+            c.fd = fd;
+            c.serial = serial;
+            c.in.reserve(READ_BUFFER);
+            c.watched = EPOLLIN | EPOLLRDHUP;
+            Watch(fd, c.watched, serial);
+        }
+    }
+
+    void Close(uint64_t serial) {
+        auto it = conns.find(serial);
+        if (it == conns.end()) return;
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+        close(it->second.fd);
+        conns.erase(it); // in-flight completions for this serial are dropped on arrival
+    }
+
+    void HandleConnection(uint64_t serial, uint32_t events) {
+        auto it = conns.find(serial);
+        if (it == conns.end()) return;
+        Connection& c = it->second;
+
+        // Both directions gone: nothing queued can be delivered any more
+        if (events & (EPOLLHUP | EPOLLERR)) { Close(serial); return; }
+
+        if (events & EPOLLOUT) {
+            if (!Flush(c)) { Close(serial); return; }
+        }
+        // EPOLLRDHUP alone is not the end: requests sent before the shutdown are still
+        // buffered, so keep reading until read() returns 0
+        if (events & (EPOLLIN | EPOLLRDHUP)) {
+            uint8_t buf[READ_BUFFER];
+            while (!c.readClosed && !c.Throttled()) {
+                ssize_t n = read(c.fd, buf, sizeof(buf));
+                if (n > 0) {
+                    c.in.insert(c.in.end(), buf, buf + n);
+                    Dispatch(serial, c);
+                    continue;
+                }
+                if (n == 0) { c.readClosed = true; break; }
+                if (errno != EAGAIN && errno != EWOULDBLOCK) { Close(serial); return; }
+                break;
+            }
+        }
+        Update(c);
+    }
+
+    // Every complete request read so far becomes part of this batch
+    void Dispatch(uint64_t serial, Connection& c) {
+        size_t count = c.in.size() / sizeof(MoveRequest);
+        if (count == 0) return;
+        const auto* reqs = reinterpret_cast<const MoveRequest*>(c.in.data());
+        for (size_t start = 0; start < count; start += CHUNK_REQUESTS) {
+            size_t end = std::min(count, start + CHUNK_REQUESTS);
+            workersPtr->Submit(Job{serial, std::vector<MoveRequest>(reqs + start, reqs + end)});
+        }
+        c.inFlight += count;
+        c.in.erase(c.in.begin(), c.in.begin() + static_cast<std::ptrdiff_t>(count * sizeof(MoveRequest)));
+    }
+
+    void DrainCompletions() {
+        uint64_t counter;
+        while (read(wakeFd, &counter, sizeof(counter)) > 0) {}
+
+        for (auto& done : workersPtr->TakeCompletions()) {
+            auto it = conns.find(done.conn);
+            if (it == conns.end()) continue;
+            Connection& c = it->second;
+            const auto* bytes = reinterpret_cast<const uint8_t*>(done.responses.data());
+            c.out.insert(c.out.end(), bytes, bytes + done.responses.size() * sizeof(MoveResponse));
+            c.inFlight -= done.responses.size();
+            served += done.responses.size();
+            if (Flush(c)) Update(c);
+            else Close(done.conn);
+        }
+    }
+
+    // Closes a half-closed connection once it is fully answered; otherwise watches
+    // EPOLLIN only below the back-pressure limits and EPOLLOUT only while output is pending
+    void Update(Connection& c) {
+        bool pending = c.outOffset < c.out.size();
+        if (c.readClosed && c.inFlight == 0 && !pending) {
+            Close(c.serial);
+            return;
+        }
+        uint32_t events = (c.readClosed || c.Throttled() ? 0u : uint32_t(EPOLLIN | EPOLLRDHUP)) |
+                          (pending ? uint32_t(EPOLLOUT) : 0u);
+        if (events != c.watched) {
+            c.watched = events;
+            Watch(c.fd, events, c.serial, EPOLL_CTL_MOD);
+        }
+    }
+
+    // Writes as much as the socket takes
+    bool Flush(Connection& c) {
+        while (c.outOffset < c.out.size()) {
+            ssize_t n = write(c.fd, c.out.data() + c.outOffset, c.out.size() - c.outOffset);
+            if (n > 0) { c.outOffset += static_cast<size_t>(n); continue; }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            return false;
+        }
+        if (c.outOffset == c.out.size()) {
+            c.out.clear();
+            c.outOffset = 0;
+        }
+        return true;
+    }
+
+    std::string socketPath;
+    int workerCount;
+    TetrisEngine::HeuristicWeights weights;
+    int listenFd = -1, epollFd = -1, wakeFd = -1;
+    WorkerPool* workersPtr = nullptr;
+    std::unordered_map<uint64_t, Connection> conns;
+    uint64_t nextSerial = 2;  // 0 and 1 tag the listen socket and the eventfd
+    uint64_t served = 0;
+};
+
+int main(int argc, char* argv[]) {
+    std::string path = TetrisEngine::Protocol::DEFAULT_SOCKET_PATH;
+    std::string weightsFile = "tetris_weights.txt";
+    int workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) path = argv[++i];
+        else if (arg == "--workers" && i + 1 < argc) workers = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--file" && i + 1 < argc) weightsFile = argv[++i];
+        else {
+            std::cout << "Usage: " << argv[0] << " [--socket <path>] [--workers <n>] [--file <weights>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    double raw[4];
+    TetrisEngine::HeuristicWeights weights{0.760666, -0.510066, -0.35663, -0.184483};
+    if (TetrisEngine::LoadWeights(weightsFile.c_str(), raw)) weights = {raw[0], raw[1], raw[2], raw[3]};
+
+    std::signal(SIGINT, [](int) { g_stop = true; });
+    std::signal(SIGTERM, [](int) { g_stop = true; });
+    std::signal(SIGPIPE, SIG_IGN);
+
+    Server server(path, workers, weights);
+    return server.Run();
+}
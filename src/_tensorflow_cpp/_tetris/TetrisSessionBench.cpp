@@ -0,0 +1,181 @@
+/*
+TETRIS SESSION POOL - 10K CONCURRENT SESSIONS STRESS BENCHMARK
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o "__test/TetrisSessionBench.exe" "_tetris/TetrisSessionBench.cpp"
+*/
+
+#include "../include/TetrisSessionPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// The bitboard search must choose the same moves as BoardEngine on identical games
+int CheckEquivalence(const TetrisEngine::HeuristicWeights& w, int positions) {
+    std::mt19937 rng(99);
+    TetrisEngine::BoardEngine board;
+    TetrisEngine::Bitboard bits;
+    int mismatches = 0;
+    for (int i = 0; i < positions; ++i) {
+        int piece = static_cast<int>(rng() % 7) + 1;
+        if (board.IsGameOver({piece, 0, 3, 0})) { board.Reset(); bits.Reset(); continue; }
+        auto a = TetrisEngine::FindBestMove(board, piece, w);
+        auto b = TetrisEngine::FindBestMove(bits, piece, w);
+        if (a.rotation != b.rotation || a.x != b.x || a.score != b.score) mismatches++;
+
+        TetrisEngine::Piece p{piece, a.rotation, a.x, 0};
+        while (board.IsValid({piece, a.rotation, a.x, p.y + 1})) p.y++;
+        board.PlacePiece(p);
+        board.ClearLines();
+        bits = TetrisEngine::Bitboard::FromBoard(board);
+    }
+    return mismatches;
+}
+
+// BoardEngine's drop: walk up from y = 0 until the piece fits, then fall
+int EngineDropY(const TetrisEngine::BoardEngine& board, int piece, int rotation, int x) {
+    TetrisEngine::Piece p{piece, rotation, x, 0};
+    while (!board.IsValid(p) && p.y > -TetrisEngine::BOARD_HEIGHT) p.y--;
+    if (p.y <= -TetrisEngine::BOARD_HEIGHT) return TetrisEngine::Bitboard::INVALID_Y;
+    while (board.IsValid({piece, rotation, x, p.y + 1})) p.y++;
+    return p.y;
+}
+
+// Stacks reaching the top rows, where some placements only fit above y = 0: every
+// DropY and every piece's best move must still agree; returns the mismatches
+int CheckTopOut(const TetrisEngine::HeuristicWeights& w, int boards, int& checks) {
+    using namespace TetrisEngine;
+    std::mt19937 rng(7);
+    int mismatches = 0;
+    checks = 0;
+    for (int i = 0; i < boards; ++i) {
+        int cells[BOARD_HEIGHT * BOARD_WIDTH] = {};
+        for (int c = 0; c < BOARD_WIDTH; ++c) {
+            int top = static_cast<int>(rng() % 5); // column reaches row 0..4
+            for (int r = top; r < BOARD_HEIGHT; ++r) cells[r * BOARD_WIDTH + c] = rng() % 5 ? 1 : 0;
+        }
+        BoardEngine board;
+        board.LoadFromArray(cells);
+        Bitboard bits = Bitboard::FromBoard(board);
+
+        for (int piece = 1; piece <= 7; ++piece) {
+            for (int r = 0; r < 4; ++r)
+                for (int x = -3; x < BOARD_WIDTH + 3; ++x, ++checks)
+                    mismatches += bits.DropY(piece, r, x) != EngineDropY(board, piece, r, x);
+            auto a = FindBestMove(board, piece, w);
+            auto b = FindBestMove(bits, piece, w);
+            mismatches += a.rotation != b.rotation || a.x != b.x || a.score != b.score;
+            checks++;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+    int sessions = 10000;
+    int rounds = 50;
+    int threads = 0;
+    double stressSeconds = 2.0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--sessions" && i + 1 < argc) sessions = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--rounds" && i + 1 < argc) rounds = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (arg == "--seconds" && i + 1 < argc) stressSeconds = std::atof(argv[++i]);
+        else {
+            std::cout << "Usage: " << argv[0] << " [--sessions <n>] [--rounds <n>] [--threads <n>] [--seconds <s>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (threads <= 0) threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    TetrisEngine::HeuristicWeights w{0.760666, -0.510066, -0.35663, -0.184483};
+    int topOutChecks = 0;
+    int topOutMismatches = CheckTopOut(w, 2000, topOutChecks);
+    std::cout << "Bitboard vs BoardEngine move mismatches: " << CheckEquivalence(w, 20000) << " / 20000\n"
+              << "Near the top (DropY and best move): " << topOutMismatches << " / " << topOutChecks << "\n\n";
+
+    TetrisEngine::SessionPool pool(w);
+    std::vector<TetrisEngine::SessionHandle> handles(sessions);
+    auto start = Clock::now();
+    for (int i = 0; i < sessions; ++i) handles[i] = pool.Create(static_cast<uint64_t>(i) + 1);
+    double createSec = Seconds(start);
+
+    std::cout << "Sessions: " << pool.ActiveCount() << ", threads: " << threads << "\n"
+              << "Memory per session: " << std::fixed << std::setprecision(1)
+              << static_cast<double>(pool.BytesAllocated()) / sessions << " bytes (slot "
+              << TetrisEngine::SessionPool::SessionBytes() << " bytes; TetrisGameInstance "
+              << sizeof(TetrisEngine::TetrisGameInstance) << " bytes + heap)\n"
+              << "Create: " << std::setprecision(0) << sessions / createSec << " sessions/s\n";
+
+    // StepAll: every round advances every session once; finished games are restarted
+    uint64_t steps = 0, restarts = 0;
+    double stepSec = 0.0;
+    TetrisEngine::SessionStats st;
+    for (int r = 0; r < rounds; ++r) {
+        start = Clock::now();
+        steps += pool.StepAll(threads);
+        stepSec += Seconds(start);
+        for (auto& h : handles) {
+            if (pool.GetState(h, nullptr, &st) && st.gameOver) {
+                pool.Destroy(h);
+                h = pool.Create(static_cast<uint64_t>(sessions) + restarts++);
+            }
+        }
+    }
+    std::cout << "StepAll: " << steps << " steps in " << std::setprecision(3) << stepSec << "s = "
+              << std::setprecision(0) << steps / stepSec << " steps/s (" << restarts << " games restarted)\n";
+
+    // Concurrent stress: workers step random sessions while one thread churns create/destroy
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> concurrentSteps{0}, staleRejects{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937 rng(static_cast<uint32_t>(t) + 1);
+            uint64_t local = 0, stale = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto h = std::atomic_ref<TetrisEngine::SessionHandle>(handles[rng() % handles.size()]).load(std::memory_order_relaxed);
+                int made = pool.Step(h, 1);
+                local += made;
+                if (!made && !pool.GetState(h, nullptr, nullptr)) stale++;
+            }
+            concurrentSteps += local;
+            staleRejects += stale;
+        });
+    }
+    std::thread churn([&] {
+        std::mt19937 rng(12345);
+        uint64_t seed = 1u << 30;
+        while (!stop.load(std::memory_order_relaxed)) {
+            // Workers may still hold the old handle; the pool must reject it once destroyed
+            size_t i = rng() % handles.size();
+            pool.Destroy(handles[i]);
+            std::atomic_ref<TetrisEngine::SessionHandle>(handles[i]).store(pool.Create(seed++));
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    });
+    start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(stressSeconds));
+    stop = true;
+    for (auto& t : workers) t.join();
+    churn.join();
+    double stressSec = Seconds(start);
+
+    std::cout << "Concurrent Step: " << concurrentSteps.load() / stressSec << " steps/s across "
+              << threads << " threads (" << staleRejects.load() << " stale handles rejected), active sessions: "
+              << pool.ActiveCount() << "\n";
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+TETRIS KNOWN-SEQUENCE SOLVER - AI OPTIMALITY GAP
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -o __test/TetrisSolver _tetris/TetrisSolver.cpp -pthread
+
+Usage:
+
+__test/TetrisSolver [--file tetris_weights.txt] [--seeds 10] [--horizon 500] [--beam 4096] [--threads 0]
+
+For seeds 1..N the piece sequence is the one TetrisGameInstance::Reset(seed) and the GA
+draw. The heuristic AI plays it greedily; the beam solver sees the whole sequence. The
+gap is (solver lines - AI lines) / solver lines over the horizon. Solver paths are
+replayed on BoardEngine to check that every placement is legal and the line count holds.
+*/
+
+#include "../include/TetrisSolver.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+struct GreedyResult {
+    int lines = 0;
+    int placed = 0;
+};
+
+GreedyResult PlayGreedy(const std::vector<int>& pieces, const TetrisEngine::HeuristicWeights& w) {
+    GreedyResult r;
+    TetrisEngine::Bitboard board;
+    for (int piece : pieces) {
+        if (board.IsGameOver(piece)) break;
+        auto m = TetrisEngine::FindBestMove(board, piece, w);
+        int y = board.DropY(piece, m.rotation, m.x);
+        if (y == TetrisEngine::Bitboard::INVALID_Y) break;
+        board.Place(piece, m.rotation, m.x, y);
+        r.lines += board.ClearLines();
+        r.placed++;
+    }
+    return r;
+}
+
+// Replays encoded moves on the reference engine; returns the lines cleared or -1 if a move is illegal
+int VerifyPath(const std::vector<int>& pieces, const std::vector<uint16_t>& moves) {
+    TetrisEngine::BoardEngine board;
+    int lines = 0;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        auto m = TetrisEngine::DecodeReplayMove(moves[i]);
+        TetrisEngine::Piece p{m.piece, m.rotation, m.x, m.y};
+        if (m.piece != pieces[i] || !board.IsValid(p) ||
+            board.IsValid({m.piece, m.rotation, m.x, m.y + 1})) return -1;
+        board.PlacePiece(p);
+        lines += board.ClearLines();
+    }
+    return lines;
+}
+
+bool LoadWeights(TetrisEngine::HeuristicWeights& w, const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) return false;
+    file >> w.w_lines >> w.w_height >> w.w_holes >> w.w_bumpiness;
+    return !file.fail();
+}
+
+int main(int argc, char* argv[]) {
+    std::string filename = "tetris_weights.txt";
+    int seeds = 10, horizon = 500;
+    TetrisEngine::Solver::SolverConfig cfg;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--file" && i + 1 < argc) filename = argv[++i];
+        else if (arg == "--seeds" && i + 1 < argc) seeds = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--horizon" && i + 1 < argc) horizon = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--beam" && i + 1 < argc) cfg.beamWidth = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) cfg.threads = std::atoi(argv[++i]);
+        else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--file <weights>] [--seeds <n>] [--horizon <pieces>] [--beam <width>] [--threads <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    TetrisEngine::HeuristicWeights weights{0.760666, -0.510066, -0.35663, -0.184483};
+    if (!LoadWeights(weights, filename)) std::cout << "Could not load " << filename << ", using default weights\n";
+
+    std::cout << "Horizon " << horizon << " pieces (at most " << horizon * 4 / TetrisEngine::BOARD_WIDTH
+              << " lines), beam " << cfg.beamWidth << "\n\n"
+              << std::setw(6) << "Seed" << std::setw(10) << "AI" << std::setw(10) << "Solver"
+              << std::setw(9) << "Gap" << std::setw(14) << "Nodes/s/core" << "\n";
+
+    TetrisEngine::Solver::BeamSolver solver(cfg);
+    long long aiTotal = 0, solverTotal = 0;
+    uint64_t nodes = 0;
+    double coreSeconds = 0.0;
+    int invalid = 0, toppedOut = 0;
+
+    for (int seed = 1; seed <= seeds; ++seed) {
+        auto pieces = TetrisEngine::Solver::SeededSequence(static_cast<uint32_t>(seed), horizon);
+        auto ai = PlayGreedy(pieces, weights);
+        auto best = solver.Solve(pieces);
+        if (VerifyPath(pieces, best.moves) != best.lines) invalid++;
+
+        if (ai.placed < horizon) toppedOut++;
+        aiTotal += ai.lines;
+        solverTotal += best.lines;
+        nodes += best.nodes;
+        coreSeconds += best.seconds * best.threads;
+        double gap = best.lines > 0 ? 100.0 * (best.lines - ai.lines) / best.lines : 0.0;
+        std::cout << std::setw(6) << seed
+                  << std::setw(10) << (std::to_string(ai.lines) + (ai.placed < horizon ? "*" : ""))
+                  << std::setw(10) << best.lines
+                  << std::setw(8) << std::fixed << std::setprecision(1) << gap << "%"
+                  << std::setw(14) << std::setprecision(0) << best.nodes / (best.seconds * best.threads) << "\n";
+    }
+
+    double gap = solverTotal > 0 ? 100.0 * (solverTotal - aiTotal) / solverTotal : 0.0;
+    if (toppedOut) std::cout << "\n* AI topped out before the horizon";
+    std::cout << "\n"
+              << std::setprecision(1)
+              << "Mean lines: AI " << static_cast<double>(aiTotal) / seeds
+              << ", solver " << static_cast<double>(solverTotal) / seeds
+              << " -> optimality gap " << gap << "%\n"
+              << std::setprecision(0) << "Solver throughput: " << nodes / coreSeconds << " nodes/s per core\n";
+    if (invalid) {
+        std::cerr << invalid << " solver path(s) failed verification\n";
+        return 1;
+    }
+    return 0;
+}
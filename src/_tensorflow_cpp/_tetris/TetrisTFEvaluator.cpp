@@ -0,0 +1,134 @@
+/*
+TETRIS VALUE NETWORK EVALUATOR - BATCHED VS PER-CANDIDATE INFERENCE
+
+Compile from root with:
+
+g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/TetrisTFEvaluator.exe" "_tetris/TetrisTFEvaluator.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+The SavedModel takes a float [N, 14] input (10 column heights, lines, aggregate height,
+holes, bumpiness - see TetrisEngine::ExtractFeatures) and returns one value per row.
+*/
+
+#include "../include/TetrisTFEvaluator.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <cstdlib>
+
+struct Position {
+    TetrisEngine::BoardEngine board;
+    int pieceId;
+};
+
+// Collects mid-game positions by letting the linear heuristic play seeded games
+std::vector<Position> CollectPositions(const TetrisEngine::HeuristicWeights& w, int count, uint32_t seed) {
+    std::vector<Position> positions;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pieceDist(1, 7);
+    TetrisEngine::BoardEngine board;
+
+    while (static_cast<int>(positions.size()) < count) {
+        int pieceId = pieceDist(rng);
+        if (board.IsGameOver({pieceId, 0, 3, 0})) { board.Reset(); continue; }
+        positions.push_back({board, pieceId});
+
+        auto m = TetrisEngine::FindBestMove(board, pieceId, w);
+        TetrisEngine::Piece p{pieceId, m.rotation, m.x, 0};
+        while (!board.IsValid(p)) p.y--;
+        while (board.IsValid({pieceId, m.rotation, m.x, p.y + 1})) p.y++;
+        board.PlacePiece(p);
+        board.ClearLines();
+    }
+    return positions;
+}
+
+struct Timing {
+    std::vector<double> latencies; // microseconds per move
+    long long candidates = 0;
+    double seconds = 0.0;
+};
+
+template <typename Fn>
+Timing Measure(const std::vector<Position>& positions, Fn&& scoreMove) {
+    Timing t;
+    t.latencies.reserve(positions.size());
+    TetrisEngine::Candidate candidates[TetrisEngine::MAX_CANDIDATES];
+    double scores[TetrisEngine::MAX_CANDIDATES];
+
+    for (const auto& pos : positions) {
+        auto start = std::chrono::steady_clock::now();
+        int n = TetrisEngine::EnumerateCandidates(pos.board, pos.pieceId, candidates);
+        scoreMove(candidates, n, scores);
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        t.latencies.push_back(us);
+        t.candidates += n;
+        t.seconds += us * 1e-6;
+    }
+    std::sort(t.latencies.begin(), t.latencies.end());
+    return t;
+}
+
+void Report(const char* name, const Timing& t) {
+    auto pct = [&](double q) { return t.latencies[static_cast<size_t>(q * (t.latencies.size() - 1))]; };
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed
+              << std::setprecision(1)
+              << " p50=" << std::setw(9) << pct(0.50) << "us"
+              << " p99=" << std::setw(9) << pct(0.99) << "us"
+              << std::setprecision(0)
+              << " moves/s=" << std::setw(9) << t.latencies.size() / t.seconds
+              << " candidates/s=" << std::setw(10) << t.candidates / t.seconds << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string modelDir = "tetris_tf_model";
+    std::string weightsFile = "tetris_weights.txt";
+    int moves = 2000;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc) modelDir = argv[++i];
+        else if (arg == "--file" && i + 1 < argc) weightsFile = argv[++i];
+        else if (arg == "--moves" && i + 1 < argc) moves = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--model <saved_model_dir>] [--file <weights>] [--moves <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    double raw[4];
+    TetrisEngine::HeuristicWeights weights{0.760666, -0.510066, -0.35663, -0.184483};
+    if (TetrisEngine::LoadWeights(weightsFile.c_str(), raw)) {
+        weights = {raw[0], raw[1], raw[2], raw[3]};
+    }
+
+    TetrisEngine::TFValueEvaluator tf;
+    tf.fallback = weights;
+    if (!tf.LoadModel(modelDir.c_str())) {
+        std::cout << "Model not available; TF numbers below measure the linear fallback.\n";
+    }
+
+    auto positions = CollectPositions(weights, moves, 12345);
+    std::cout << "Positions: " << positions.size() << "\n\n";
+
+    TetrisEngine::LinearEvaluator linear{weights};
+    Report("linear", Measure(positions, [&](auto* c, int n, double* s) { linear.ScoreBatch(c, n, s); }));
+    Report("tf batched", Measure(positions, [&](auto* c, int n, double* s) { tf.ScoreBatch(c, n, s); }));
+    Report("tf per-cand", Measure(positions, [&](auto* c, int n, double* s) { tf.ScoreEach(c, n, s); }));
+
+    // Batched and per-candidate inference must agree on the chosen move
+    int mismatches = 0;
+    TetrisEngine::Candidate candidates[TetrisEngine::MAX_CANDIDATES];
+    double batched[TetrisEngine::MAX_CANDIDATES], single[TetrisEngine::MAX_CANDIDATES];
+    for (size_t i = 0; i < positions.size() && i < 200; ++i) {
+        int n = TetrisEngine::EnumerateCandidates(positions[i].board, positions[i].pieceId, candidates);
+        tf.ScoreBatch(candidates, n, batched);
+        tf.ScoreEach(candidates, n, single);
+        if (std::max_element(batched, batched + n) - batched != std::max_element(single, single + n) - single)
+            mismatches++;
+    }
+    std::cout << "\nBest-move mismatches (batched vs per-candidate): " << mismatches << "\n";
+    return 0;
+}
@@ -24,6 +24,8 @@ g++ -std=c++20 -O3 -o tetris.exe  tetris.cpp
 #include <fstream>
 #include <sstream>
 
+#include "../include/TetrisRenderer.h"
+
 // For Windows ANSI support
 #ifdef _WIN32
 #include <windows.h>
@@ -86,32 +88,10 @@ namespace Random {
     }
 }
 
-// --- Graphics Constants ---
-const std::string RESET_COLOR = "\033[0m";
-const std::string EMPTY_COLOR = "\033[1;30m";
-const std::string I_COLOR = "\033[1;36m";
-const std::string O_COLOR = "\033[1;33m";
-const std::string T_COLOR = "\033[1;35m";
-const std::string S_COLOR = "\033[1;32m";
-const std::string Z_COLOR = "\033[1;31m";
-const std::string J_COLOR = "\033[1;34m";
-const std::string L_COLOR = "\033[1;91m";
-const std::string WALL_COLOR = "\033[1;37m";
-const std::string PREVIEW_COLOR = "\033[1;90m";
-
-std::string GetColor(int pieceId) {
-    if (!USE_FANCY_GRAPHICS) return "";
-    switch (pieceId) {
-        case 0: return EMPTY_COLOR;
-        case 1: return I_COLOR;
-        case 2: return O_COLOR;
-        case 3: return T_COLOR;
-        case 4: return S_COLOR;
-        case 5: return Z_COLOR;
-        case 6: return J_COLOR;
-        case 7: return L_COLOR;
-        default: return RESET_COLOR;
-    }
+// --- Graphics ---
+TetrisConsole::FrameRenderer& Renderer() {
+    static TetrisConsole::FrameRenderer renderer(USE_FANCY_GRAPHICS);
+    return renderer;
 }
 
 void ClearScreen() {
@@ -283,86 +263,25 @@ public:
             }
         }
 
-        if (!USE_FANCY_GRAPHICS) {
-            // ASCII-only rendering
-            std::cout << "+----------------------+      Next:\n";
-            for (int r = 0; r < BOARD_HEIGHT; ++r) {
-                std::cout << "|";
-                for (int c = 0; c < BOARD_WIDTH; ++c) {
-                    if (tempGrid[r][c] == 0) {
-                        std::cout << " .";
-                    } else {
-                        std::cout << " #";
-                    }
-                }
-                std::cout << " |";
-                
-                // Show next piece preview on the right
-                if (r >= 2 && r <= 5 && nextPieceId > 0) {
-                    const auto& nextShape = TETROMINO_SHAPES[nextPieceId - 1][0];
-                    int previewRow = r - 2;
-                    std::cout << "      ";
-                    for (int c = 0; c < 4; ++c) {
-                        if (nextShape[previewRow][c] != 0) {
-                            std::cout << "# ";
-                        } else {
-                            std::cout << "  ";
-                        }
-                    }
-                } else if (r == 1) {
-                    std::cout << "      ----";
-                } else if (r == 0) {
-                    std::cout << "      Next";
-                }
-                
-                // Show stats
-                if (r == 7) std::cout << "  Score: " << score;
-                if (r == 9) std::cout << "  Lines: " << lines;
-                if (r == 11) std::cout << "  Level: " << level;
-                std::cout << "\n";
-            }
-            std::cout << "+----------------------+\n";
-            return;
-        }
+        int cells[BOARD_HEIGHT * BOARD_WIDTH];
+        for (int r = 0; r < BOARD_HEIGHT; ++r)
+            for (int c = 0; c < BOARD_WIDTH; ++c) cells[r * BOARD_WIDTH + c] = tempGrid[r][c];
 
-        // Fancy Unicode rendering
-        std::cout << WALL_COLOR << "╔═════════════════════╗" << PREVIEW_COLOR << "     " << RESET_COLOR << "\n";
-        for (int r = 0; r < BOARD_HEIGHT; ++r) {
-            std::cout << WALL_COLOR << "║" << RESET_COLOR;
-            for (int c = 0; c < BOARD_WIDTH; ++c) {
-                if (tempGrid[r][c] == 0) {
-                    std::cout << EMPTY_COLOR << " ." << RESET_COLOR;
-                } else {
-                    std::cout << GetColor(tempGrid[r][c]) << " ■" << RESET_COLOR;
-                }
-            }
-            std::cout << WALL_COLOR << " ║" << RESET_COLOR;
-            
-            // Show next piece preview
-            if (r >= 2 && r <= 5 && nextPieceId > 0) {
-                const auto& nextShape = TETROMINO_SHAPES[nextPieceId - 1][0];
-                int previewRow = r - 2;
-                std::cout << PREVIEW_COLOR << "      " << RESET_COLOR;
-                for (int c = 0; c < 4; ++c) {
-                    if (nextShape[previewRow][c] != 0) {
-                        std::cout << GetColor(nextShape[previewRow][c]) << "■ " << RESET_COLOR;
-                    } else {
-                        std::cout << "  ";
-                    }
-                }
-            } else if (r == 1) {
-                std::cout << PREVIEW_COLOR << "      ────" << RESET_COLOR;
-            } else if (r == 0) {
-                std::cout << PREVIEW_COLOR << "      Next" << RESET_COLOR;
-            }
-            
-            // Show stats
-            if (r == 7) std::cout << "  Score: " << score;
-            if (r == 9) std::cout << "  Lines: " << lines;
-            if (r == 11) std::cout << "  Level: " << level;
-            std::cout << "\n";
+        int preview[16] = {};
+        if (nextPieceId > 0) {
+            const auto& nextShape = TETROMINO_SHAPES[nextPieceId - 1][0];
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c) preview[r * 4 + c] = nextShape[r][c];
         }
-        std::cout << WALL_COLOR << "╚═════════════════════╝" << RESET_COLOR << "\n";
+
+        // Only cells that changed since the previous frame reach the terminal
+        TetrisConsole::FrameInput frame;
+        frame.cells = cells;
+        frame.preview = nextPieceId > 0 ? preview : nullptr;
+        frame.score = score;
+        frame.lines = lines;
+        frame.level = level;
+        Renderer().Render(frame);
     }
 
     int GetAggregateHeight() const {
@@ -596,14 +515,12 @@ HeuristicWeights RunGeneticAlgorithm() {
 }
 
 void PlayVisibleGame(const HeuristicWeights& w) {
-    ClearScreen();
+    Renderer().Invalidate();
     Board board;
     int score = 0, lines = 0, level = 1;
     int nextPieceId = Random::Int(1, 7);
     bool over = false;
 
-    std::cout << "--- AI Playing Tetris ---\n";
-    
     while (!over) {
         int currentPieceId = nextPieceId;
         nextPieceId = Random::Int(1, 7);
@@ -612,8 +529,6 @@ void PlayVisibleGame(const HeuristicWeights& w) {
         if (board.IsGameOver(p)) { over = true; break; }
         
         // Show initial position (preview at top)
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
         board.Render(score, lines, level, &p, nextPieceId);
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
         
@@ -630,8 +545,6 @@ void PlayVisibleGame(const HeuristicWeights& w) {
         // Show hard drop animation (fast but visible)
         for (int dropY = y; dropY <= finalY; ++dropY) {
             p.y = dropY;
-            ClearScreen();
-            std::cout << "--- AI Playing ---\n";
             board.Render(score, lines, level, &p, nextPieceId);
             std::this_thread::sleep_for(std::chrono::milliseconds(30));
         }
@@ -646,8 +559,6 @@ void PlayVisibleGame(const HeuristicWeights& w) {
         }
         
         // Show final placement briefly
-        ClearScreen();
-        std::cout << "--- AI Playing ---\n";
         board.Render(score, lines, level, nullptr, nextPieceId);
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
@@ -0,0 +1,266 @@
+/*
+
+	=====================================================================================
+	== m,n,k games - retrograde endgame table builder
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -o "__test/MNKRetrograde.exe"  "_tictactoe/MNKRetrograde.cpp" -m64 -Wl,--subsystem,console
+
+	__test/MNKRetrograde.exe [--size <m> <n> <k>] [--out <file>] [--threads <n>] [--verify <positions>]
+
+	Solves every state of the board (default 4 4 4) and writes it as an MNK::EndgameTable
+	(2 bits per state, see MNKGame.h). States are enumerated by stone count, from the full
+	board down to the empty one; each level only reads the level above, so its occupancy
+	patterns are shared out to the worker threads. Reports build time and table size, then
+	maps the written file and checks random positions against the alpha-beta search.
+
+*/
+
+#include "../include/MNKGame.h"
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Builder {
+    int width, height, k, cells;
+    uint32_t fullMask;
+    std::vector<uint32_t> lines;        // every k-window as a cell mask
+    std::vector<uint64_t> pow3;
+    std::vector<uint64_t> words;
+    uint64_t base3Low[1024];             // base-3 value of a 10-cell mask
+
+    Builder(int w, int h, int inRow) : width(w), height(h), k(inRow), cells(w * h) {
+        fullMask = (cells == 32) ? ~0u : ((1u << cells) - 1);
+        pow3.assign(cells + 1, 1);
+        for (int i = 1; i <= cells; ++i) pow3[i] = pow3[i - 1] * 3;
+        for (uint32_t m = 0; m < 1024; ++m) {
+            base3Low[m] = 0;
+            for (int i = 9; i >= 0; --i) base3Low[m] = base3Low[m] * 3 + ((m >> i) & 1);
+        }
+        const int dirs[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+        for (const auto& d : dirs) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int ex = x + d[0] * (k - 1), ey = y + d[1] * (k - 1);
+                    if (ex < 0 || ex >= width || ey < 0 || ey >= height) continue;
+                    uint32_t line = 0;
+                    for (int i = 0; i < k; ++i) line |= 1u << ((y + d[1] * i) * width + x + d[0] * i);
+                    lines.push_back(line);
+                }
+            }
+        }
+        words.assign(MNK::EndgameWords(MNK::EndgameStates(cells)), 0);
+    }
+
+    uint64_t base3(uint32_t mask) const { return base3Low[mask & 1023] + base3Low[(mask >> 10) & 1023] * 59049; }
+
+    bool hasLine(uint32_t mask) const {
+        for (uint32_t line : lines)
+            if ((mask & line) == line) return true;
+        return false;
+    }
+
+    int get(uint64_t index) const {
+        return static_cast<int>((std::atomic_ref<const uint64_t>(words[index >> 5]).load(std::memory_order_relaxed) >>
+                                 ((index & 31) * 2)) & 3);
+    }
+
+    void set(uint64_t index, int value) {
+        std::atomic_ref<uint64_t>(words[index >> 5]).fetch_or(static_cast<uint64_t>(value) << ((index & 31) * 2),
+                                                               std::memory_order_relaxed);
+    }
+
+    // Value for 'player' to move with X on xs and O on os; children (one more stone) are solved
+    int solve(uint32_t xs, uint32_t os, int player, uint64_t code) const {
+        uint32_t mine = player == 1 ? xs : os, theirs = player == 1 ? os : xs;
+        if (hasLine(mine)) return MNK::TABLE_UNKNOWN;       // the side to move can't have won already
+        if (hasLine(theirs)) return MNK::TABLE_LOSS;
+        uint32_t empty = fullMask & ~(xs | os);
+        if (empty == 0) return MNK::TABLE_DRAW;
+
+        bool draw = false;
+        for (uint32_t m = empty; m; m &= m - 1) {
+            int c = __builtin_ctz(m);
+            uint64_t child = code + (player == 1 ? 1 : 2) * pow3[c];
+            int v = get(child * 2 + (player == 1 ? 1 : 0));
+            if (v == MNK::TABLE_LOSS) return MNK::TABLE_WIN;
+            if (v == MNK::TABLE_DRAW) draw = true;
+        }
+        return draw ? MNK::TABLE_DRAW : MNK::TABLE_LOSS;
+    }
+
+    // All states with 'stones' stones: X has stones/2 rounded either way, O the rest
+    void solveLevel(const std::vector<uint32_t>& occupancies, int threads, uint64_t counts[4]) {
+        std::atomic<size_t> next{0};
+        std::vector<std::array<uint64_t, 4>> perThread(threads, std::array<uint64_t, 4>{});
+        auto work = [&](int t) {
+            size_t i;
+            while ((i = next.fetch_add(1, std::memory_order_relaxed)) < occupancies.size()) {
+                uint32_t occ = occupancies[i];
+                int stones = __builtin_popcount(occ);
+                // Walk every subset of occ as X's stones
+                for (uint32_t xs = occ;; xs = (xs - 1) & occ) {
+                    int x = __builtin_popcount(xs), o = stones - x;
+                    if (x - o >= -1 && x - o <= 1) {
+                        uint32_t os = occ ^ xs;
+                        uint64_t code = base3(xs) + 2 * base3(os);
+                        // Equal counts: either side may be to move; otherwise the side with fewer stones
+                        for (int player : {1, -1}) {
+                            if ((x > o && player == 1) || (o > x && player == -1)) continue;
+                            int v = solve(xs, os, player, code);
+                            if (v != MNK::TABLE_UNKNOWN) set(code * 2 + (player == 1 ? 0 : 1), v);
+                            perThread[t][v]++;
+                        }
+                    }
+                    if (xs == 0) break;
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t) pool.emplace_back(work, t);
+        work(0);
+        for (auto& th : pool) th.join();
+        for (const auto& c : perThread)
+            for (int v = 0; v < 4; ++v) counts[v] += c[v];
+    }
+};
+
+const char* valueName(int v) {
+    switch (v) {
+        case MNK::TABLE_WIN:  return "win";
+        case MNK::TABLE_LOSS: return "loss";
+        case MNK::TABLE_DRAW: return "draw";
+        default:              return "unknown";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int width = 4, height = 4, k = 4;
+    std::string out;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    int verify = 2000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--size" && i + 3 < argc) {
+            width = std::atoi(argv[++i]);
+            height = std::atoi(argv[++i]);
+            k = std::atoi(argv[++i]);
+        }
+        else if (arg == "--out" && i + 1 < argc) out = argv[++i];
+        else if (arg == "--threads" && i + 1 < argc) threads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--verify" && i + 1 < argc) verify = std::max(0, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--size <m> <n> <k>] [--out <file>] [--threads <n>] [--verify <positions>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (width < 1 || height < 1 || k < 2 || width * height > MNK::TABLE_MAX_CELLS) {
+        std::cerr << "Board must have 1.." << MNK::TABLE_MAX_CELLS << " cells and k >= 2\n";
+        return 1;
+    }
+    if (out.empty()) out = "mnk_" + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(k) + ".tbl";
+
+    // --- Build ---
+    auto start = std::chrono::steady_clock::now();
+    Builder builder(width, height, k);
+    int cells = builder.cells;
+    std::vector<std::vector<uint32_t>> levels(cells + 1);
+    for (uint32_t occ = 0; occ <= builder.fullMask; ++occ) {
+        levels[__builtin_popcount(occ)].push_back(occ);
+        if (occ == builder.fullMask) break;
+    }
+
+    uint64_t counts[4] = {0, 0, 0, 0};
+    std::cout << "Solving " << width << "," << height << "," << k << " with " << threads << " threads\n";
+    for (int stones = cells; stones >= 0; --stones) {
+        auto levelStart = std::chrono::steady_clock::now();
+        uint64_t levelCounts[4] = {0, 0, 0, 0};
+        builder.solveLevel(levels[stones], threads, levelCounts);
+        for (int v = 0; v < 4; ++v) counts[v] += levelCounts[v];
+        std::cout << "  stones " << std::setw(2) << stones << ": " << std::setw(10)
+                  << levelCounts[1] + levelCounts[2] + levelCounts[3] << " states in " << std::fixed
+                  << std::setprecision(3)
+                  << std::chrono::duration<double>(std::chrono::steady_clock::now() - levelStart).count() << " s\n";
+    }
+    double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // --- Write ---
+    MNK::EndgameHeader header{};
+    std::memcpy(header.magic, MNK::TABLE_MAGIC, 4);
+    header.version = MNK::TABLE_VERSION;
+    header.width = width;
+    header.height = height;
+    header.k = k;
+    header.states = MNK::EndgameStates(cells);
+    std::FILE* file = std::fopen(out.c_str(), "wb");
+    if (!file || std::fwrite(&header, sizeof(header), 1, file) != 1 ||
+        std::fwrite(builder.words.data(), sizeof(uint64_t), builder.words.size(), file) != builder.words.size()) {
+        std::cerr << "Failed to write " << out << "\n";
+        if (file) std::fclose(file);
+        return 1;
+    }
+    std::fclose(file);
+    uint64_t bytes = sizeof(header) + builder.words.size() * sizeof(uint64_t);
+
+    std::cout << "Build time: " << std::setprecision(2) << buildSeconds << " s\n"
+              << "Legal states: " << counts[1] + counts[2] + counts[3] << " (win " << counts[1] << ", loss "
+              << counts[2] << ", draw " << counts[3] << ")\n"
+              << "Table: " << out << ", " << header.states << " slots, " << std::setprecision(1)
+              << bytes / (1024.0 * 1024.0) << " MB\n";
+
+    // --- Serve from the mapped file ---
+    MNK::EndgameTable table(out);
+    MNK::Board board(width, height, k);
+    if (!table.Covers(board)) {
+        std::cerr << "Could not map " << out << "\n";
+        return 1;
+    }
+    std::cout << "Empty board: X to move " << valueName(table.Probe(board, 1)) << ", O to move "
+              << valueName(table.Probe(board, -1)) << "\n";
+
+    // Random reachable positions (either opener) against a full alpha-beta solve
+    std::mt19937 rng(2024);
+    MNK::Search search(20);
+    int checked = 0, mismatches = 0, unsolved = 0;
+    double probeSeconds = 0.0;
+    uint64_t probes = 0;
+    for (int n = 0; n < verify; ++n) {
+        board.reset();
+        int player = (rng() & 1) ? 1 : -1;
+        int plies = static_cast<int>(rng() % (cells + 1));
+        bool over = false;
+        for (int p = 0; p < plies && !board.isFull() && !over; ++p) {
+            int move;
+            do move = static_cast<int>(rng() % cells); while (!board.isEmpty(move));
+            board.play(move, player);
+            over = board.isWin(move);
+            player = -player;
+        }
+        if (over || board.isFull()) continue;
+
+        auto probeStart = std::chrono::steady_clock::now();
+        int value = table.Probe(board, player);
+        probeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - probeStart).count();
+        probes++;
+
+        MNK::SearchResult r = search.think(board, player, {2.0, 0});
+        if (!r.solved) { unsolved++; continue; }
+        int expected = std::abs(r.value) > MNK::WIN_THRESHOLD ? (r.value > 0 ? MNK::TABLE_WIN : MNK::TABLE_LOSS)
+                                                              : MNK::TABLE_DRAW;
+        checked++;
+        if (value != expected) mismatches++;
+    }
+    std::cout << "Verified " << checked << " random positions against search: " << mismatches << " mismatches";
+    if (unsolved) std::cout << " (" << unsolved << " skipped, search unsolved within 2 s)";
+    std::cout << "\n";
+    if (probes) std::cout << "Probe latency: " << std::setprecision(0) << probeSeconds / probes * 1e9 << " ns\n";
+    return mismatches ? 1 : 0;
+}
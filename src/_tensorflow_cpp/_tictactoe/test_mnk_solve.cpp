@@ -0,0 +1,118 @@
+/*
+
+	=====================================================================================
+	== m,n,k games - alpha-beta solve times and nodes/sec per board size
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_mnk_solve.exe"  "_tictactoe/test_mnk_solve.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+	__test/test_mnk_solve.exe [--budget <seconds per board>] [--selfplay <games per mode>]
+
+	First checks the engine on 3,3,3 against the solved MINIMAX table of tictactoe.h (value
+	and best move of every reachable position, either side to move). Then searches the empty
+	board of each size with X to move until solved or out of budget, and optionally plays
+	self-play games on 5,5,4 with every AI mode.
+
+*/
+
+#include "../include/tictactoe.h"
+#include "../include/MNKGame.h"
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+// Walks every reachable 3x3 position and compares the engine with minimaxLookup
+void checkTicTacToe(std::vector<int>& cells, int player, std::set<std::pair<int, int>>& seen,
+                    MNK::Search& search, int& positions, int& valueMismatches, int& moveMismatches) {
+    if (!seen.insert({encodeBoard(cells.data()), player}).second) return;
+    MNK::Board board(3, 3, 3);
+    for (int i = 0; i < 9; ++i)
+        if (cells[i] != 0) board.play(i, cells[i]);
+    if (board.winner() != 0 || board.isFull()) return;
+
+    const MinimaxEntry& expected = minimaxLookup(cells.data(), player);
+    MNK::SearchResult r = search.think(board, player, {60.0, 0});
+    positions++;
+
+    // Table values are from X: 10 - plies to the win; engine values from the side to move
+    int pliesToEnd = MNK::WIN_SCORE - std::abs(r.value);
+    int value = std::abs(r.value) > MNK::WIN_THRESHOLD ? (r.value > 0 ? 1 : -1) * (10 - pliesToEnd) * player : 0;
+    if (!r.solved || value != expected.value) valueMismatches++;
+    if (r.move < 0 || !(expected.bestMoves & (1u << r.move))) moveMismatches++;
+
+    for (int i = 0; i < 9; ++i) {
+        if (cells[i] != 0) continue;
+        cells[i] = player;
+        checkTicTacToe(cells, -player, seen, search, positions, valueMismatches, moveMismatches);
+        cells[i] = 0;
+    }
+}
+
+std::string describe(const MNK::SearchResult& r) {
+    if (std::abs(r.value) > MNK::WIN_THRESHOLD)
+        return std::string(r.value > 0 ? "X wins" : "O wins") + " in " + std::to_string(MNK::WIN_SCORE - std::abs(r.value));
+    return r.solved ? "draw" : "unsolved (eval " + std::to_string(r.value) + ")";
+}
+
+int main(int argc, char* argv[]) {
+    double budget = 30.0;
+    int selfPlayGames = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--budget" && i + 1 < argc) budget = std::atof(argv[++i]);
+        else if (arg == "--selfplay" && i + 1 < argc) selfPlayGames = std::atoi(argv[++i]);
+        else {
+            std::cout << "Usage: " << argv[0] << " [--budget <seconds per board>] [--selfplay <games per mode>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    MNK::Search search(22);
+
+    int positions = 0, valueMismatches = 0, moveMismatches = 0;
+    std::set<std::pair<int, int>> seen;
+    std::vector<int> empty(9, 0);
+    checkTicTacToe(empty, 1, seen, search, positions, valueMismatches, moveMismatches);
+    checkTicTacToe(empty, -1, seen, search, positions, valueMismatches, moveMismatches);
+    std::cout << "3,3,3 vs MINIMAX table: " << positions << " positions, value mismatches " << valueMismatches
+              << ", move mismatches " << moveMismatches << "\n\n";
+
+    const int sizes[][3] = {{3, 3, 3}, {4, 3, 3}, {4, 4, 3}, {4, 4, 4}, {5, 4, 4}, {5, 5, 4}, {6, 6, 4}, {7, 7, 5}, {15, 15, 5}};
+    std::cout << std::left << std::setw(10) << "m,n,k" << std::setw(24) << "result (X to move)" << std::right
+              << std::setw(7) << "depth" << std::setw(14) << "nodes" << std::setw(12) << "nodes/s"
+              << std::setw(11) << "seconds" << "\n";
+    for (const auto& s : sizes) {
+        MNK::Board board(s[0], s[1], s[2]);
+        search.clear();
+        MNK::SearchResult r = search.think(board, 1, {budget, 0});
+        std::string name = std::to_string(s[0]) + "," + std::to_string(s[1]) + "," + std::to_string(s[2]);
+        std::cout << std::left << std::setw(10) << name << std::setw(24) << describe(r) << std::right
+                  << std::setw(7) << r.depth << std::setw(14) << r.nodes
+                  << std::setw(12) << std::fixed << std::setprecision(0) << r.nodes / std::max(r.seconds, 1e-9)
+                  << std::setw(11) << std::setprecision(3) << r.seconds << "\n";
+    }
+
+    if (selfPlayGames > 0) {
+        const char* names[] = {"EXPERT", "CREATIVE", "MINIMAX", "RANDOM"};
+        std::cout << "\nSelf-play on 5,5,4 (" << selfPlayGames << " games per mode, 0.1 s per MINIMAX move)\n";
+        for (int mode = EXPERT; mode <= RANDOM; ++mode) {
+            int firstWins = 0, secondWins = 0, draws = 0, plies = 0;
+            for (int g = 0; g < selfPlayGames; ++g) {
+                MNK::GameRecord record;
+                MNK::RunSelfPlay(5, 5, 4, mode, 1.0, {0.1, 0}, record);
+                plies += static_cast<int>(record.moves.size());
+                if (record.winner == 0) draws++;
+                else if (record.winner == record.firstPlayer) firstWins++;
+                else secondWins++;
+            }
+            std::cout << std::left << std::setw(10) << names[mode] << std::right << "first " << firstWins
+                      << ", second " << secondWins << ", draws " << draws << ", avg plies "
+                      << std::setprecision(1) << static_cast<double>(plies) / selfPlayGames << "\n";
+        }
+    }
+    return (valueMismatches || moveMismatches) ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - mini-batch training (trainBatch) vs per-sample backprop
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_batch_bench.exe"  "_tictactoe/test_tic_tac_toe_batch_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+	__test/test_tic_tac_toe_batch_bench.exe [--batch <size>] [--epochs <n>] [--hidden <units>] [--lr <per-sample rate>] [--batch-lr <rate>]
+
+	Samples are the positions reachable with X opening, labelled by the MINIMAX table (target
+	1 on every best move, 0 elsewhere). Checks that a batch of one matches forward + backprop
+	and that a trainStep game through a batch of one takes trainStep's step, then reports
+	samples/sec for both paths, trainStep games/sec with and without a batch, and agreement
+	of the greedy move with the table over the training epochs.
+
+*/
+
+#include "tictactoe_bench.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+template <typename T>
+void trainPerSample(NeuralNetworkT<T>& net, const std::vector<Position>& samples, const std::vector<int>& order) {
+    for (int k : order) {
+        net.forward(samples[k].input);
+        net.backprop(samples[k].target);
+    }
+}
+
+template <typename T>
+void trainBatched(NeuralNetworkT<T>& net, const std::vector<Position>& samples, const std::vector<int>& order,
+                  TrainingBatch& batch) {
+    for (int k : order) {
+        batch.add(samples[k].input, samples[k].target);
+        if (batch.full()) {
+            net.trainBatch(batch);
+            batch.clear();
+        }
+    }
+    net.trainBatch(batch);
+    batch.clear();
+}
+
+template <typename Fn>
+double seconds(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Largest weight difference in the output layer (weights_ho, bias_o) or the hidden layer
+template <typename T>
+double maxLayerDiff(const NeuralNetworkT<T>& a, const NeuralNetworkT<T>& b, bool outputLayer) {
+    double diff = 0;
+    auto cmp = [&](const AlignedVector<T>& x, const AlignedVector<T>& y) {
+        for (size_t i = 0; i < x.size(); ++i) diff = std::max(diff, std::abs(static_cast<double>(x[i] - y[i])));
+    };
+    if (outputLayer) {
+        cmp(a.weights_ho, b.weights_ho);
+        cmp(a.bias_o, b.bias_o);
+    } else {
+        cmp(a.weights_ih, b.weights_ih);
+        cmp(a.bias_h, b.bias_h);
+    }
+    return diff;
+}
+
+template <typename T>
+double maxWeightDiff(const NeuralNetworkT<T>& a, const NeuralNetworkT<T>& b) {
+    return std::max(maxLayerDiff(a, b, true), maxLayerDiff(a, b, false));
+}
+
+template <typename T>
+void throughput(const char* name, const std::vector<Position>& samples, const std::vector<int>& order, int batchSize) {
+    NeuralNetworkT<T> perSample(9, 18, 9), batched = perSample;
+    TrainingBatch batch(9, 9, batchSize);
+    const int rounds = 20;
+    double perSampleSec = seconds([&] { for (int r = 0; r < rounds; ++r) trainPerSample(perSample, samples, order); });
+    double batchedSec = seconds([&] { for (int r = 0; r < rounds; ++r) trainBatched(batched, samples, order, batch); });
+    double total = static_cast<double>(samples.size()) * rounds;
+    std::cout << std::fixed << std::setprecision(0) << name << " per-sample " << total / perSampleSec
+              << " samples/s, batch " << batchSize << " " << total / batchedSec << " samples/s ("
+              << std::setprecision(2) << perSampleSec / batchedSec << "x)\n";
+}
+
+int main(int argc, char* argv[]) {
+    int batchSize = 32, epochs = 200, hiddenSize = 18;
+    double learningRate = 0.1, batchLearningRate = -1;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--batch" && i + 1 < argc) batchSize = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--epochs" && i + 1 < argc) epochs = std::atoi(argv[++i]);
+        else if (arg == "--hidden" && i + 1 < argc) hiddenSize = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--lr" && i + 1 < argc) learningRate = std::atof(argv[++i]);
+        else if (arg == "--batch-lr" && i + 1 < argc) batchLearningRate = std::atof(argv[++i]);
+        else {
+            std::cout << "Usage: " << argv[0] << " [--batch <size>] [--epochs <n>] [--hidden <units>] [--lr <rate>] [--batch-lr <rate>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    // trainBatch averages the gradient, so by default the batch takes a proportionally larger step
+    if (batchLearningRate < 0) batchLearningRate = learningRate * batchSize;
+
+    std::vector<Position> samples = collectPositions();
+    std::vector<int> order(samples.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<int>(i);
+    std::cout << "Positions (X opens): " << samples.size() << "\n";
+
+    // A batch of one is forward() + backprop()
+    gen.seed(7);
+    NeuralNetwork single(9, 18, 9), reference = single;
+    TrainingBatch one(9, 9, 1);
+    trainPerSample(reference, samples, order);
+    trainBatched(single, samples, order, one);
+    double batchOfOneDiff = maxWeightDiff(single, reference);
+    std::cout << std::scientific << std::setprecision(2) << "Batch of one vs backprop, max weight diff after "
+              << samples.size() << " samples: " << batchOfOneDiff << "\n";
+
+    // One game through trainStep(net, batch of one) takes the step of trainStep(net): the row
+    // weight (moves played) scales the gradient. The output layer matches exactly; trainStep's
+    // repeated backprops re-read weights_ho for the hidden layer, a second-order difference.
+    double outputGameDiff = 0, hiddenGameDiff = 0;
+    for (int g = 0; g < 100; ++g) {
+        NeuralNetwork start(9, 18, 9), serial = start, viaBatch = start;
+        trainStep(serial);
+        trainStep(viaBatch, one);
+        outputGameDiff = std::max(outputGameDiff, maxLayerDiff(viaBatch, serial, true) / maxLayerDiff(serial, start, true));
+        hiddenGameDiff = std::max(hiddenGameDiff, maxLayerDiff(viaBatch, serial, false) / maxLayerDiff(serial, start, false));
+    }
+    std::cout << "trainStep via a batch of one vs trainStep, worst weight diff over 100 games (of the step): output layer "
+              << outputGameDiff << ", hidden layer " << std::fixed << std::setprecision(2) << hiddenGameDiff << "\n\n";
+
+    // Throughput over the same samples
+    throughput<double>("double", samples, order, batchSize);
+    throughput<float>("float ", samples, order, batchSize);
+
+    // Self-play: trainStep with and without a batch
+    {
+        const int games = 20000;
+        NeuralNetwork perSample(9, 18, 9), batched = perSample;
+        TrainingBatch batch(9, 9, batchSize);
+        double perSampleSec = seconds([&] { for (int g = 0; g < games; ++g) trainStep(perSample); });
+        double batchedSec = seconds([&] {
+            for (int g = 0; g < games; ++g) trainStep(batched, batch);
+            batched.trainBatch(batch);
+            batch.clear();
+        });
+        std::cout << std::fixed << std::setprecision(0) << "trainStep         " << games / perSampleSec
+                  << " games/s, with batch " << games / batchedSec << " games/s (" << std::setprecision(2)
+                  << perSampleSec / batchedSec << "x)\n\n";
+    }
+
+    // Convergence against the MINIMAX table, both paths seeing the same shuffled samples
+    gen.seed(11);
+    NeuralNetwork perSample(9, hiddenSize, 9), batched = perSample;
+    perSample.learningRate = learningRate;
+    batched.learningRate = batchLearningRate;
+    TrainingBatch batch(9, 9, batchSize);
+    std::mt19937 shuffler(3);
+    double perSampleSec = 0, batchedSec = 0;
+    std::cout << "Agreement with MINIMAX best moves (per-sample lr " << std::setprecision(3) << learningRate
+              << ", batch " << batchSize << " lr " << batchLearningRate << ")\n"
+              << std::setw(8) << "epoch" << std::setw(14) << "per-sample" << std::setw(10) << "batch" << "\n"
+              << std::setw(8) << 0 << std::setw(14) << strength(perSample, samples) << std::setw(10)
+              << strength(batched, samples) << "\n";
+    for (int e = 1, report = 1; e <= epochs; ++e) {
+        std::shuffle(order.begin(), order.end(), shuffler);
+        perSampleSec += seconds([&] { trainPerSample(perSample, samples, order); });
+        batchedSec += seconds([&] { trainBatched(batched, samples, order, batch); });
+        if (e != report && e != epochs) continue;
+        report = std::to_string(report)[0] == '2' ? report / 2 * 5 : report * 2; // 1, 2, 5, 10, 20, 50, ...
+        std::cout << std::setw(8) << e << std::setw(14) << strength(perSample, samples) << std::setw(10)
+                  << strength(batched, samples) << "\n";
+    }
+    std::cout << std::setprecision(2) << "Training time: per-sample " << perSampleSec << " s, batch " << batchedSec
+              << " s\n";
+    return batchOfOneDiff > 1e-9 || outputGameDiff > 1e-9 ? 1 : 0;
+}
@@ -0,0 +1,65 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - MINIMAX table lookup vs recursive search
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_bench.exe"  "_tictactoe/test_tic_tac_toe_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+	Checks every reachable position (either side opening) against the recursive search,
+	then reports the table's cold-start cost and moves/sec for both.
+
+*/
+
+#include "tictactoe_bench.h"
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <vector>
+
+template <typename Fn>
+double timeMoves(const std::vector<Position>& positions, int rounds, Fn&& fn, long long& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r)
+        for (const auto& p : positions) checksum += fn(p.board, p.player);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    auto coldStart = std::chrono::steady_clock::now();
+    const auto& table = minimaxTable();
+    double coldMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - coldStart).count();
+
+    std::vector<Position> positions;
+    std::set<std::pair<int, int>> seen;
+    std::vector<int> empty(9, 0);
+    collectPositions(empty, 1, seen, positions);
+    collectPositions(empty, -1, seen, positions);
+
+    int moveMismatches = 0, valueMismatches = 0;
+    for (const auto& p : positions) {
+        if (minimaxMove(p.board, p.player) != minimaxMoveSearch(p.board, p.player)) moveMismatches++;
+        if (minimaxLookup(p.board.data(), p.player).value != minimax(p.board.data(), 0, p.player == 1)) valueMismatches++;
+    }
+
+    long long checksumTable = 0, checksumSearch = 0;
+    double searchSec = timeMoves(positions, 1, minimaxMoveSearch, checksumSearch);
+    int rounds = 200;
+    double tableSec = timeMoves(positions, rounds, [](const std::vector<int>& b, int p) { return minimaxMove(b, p); }, checksumTable);
+
+    double searchRate = positions.size() / searchSec;
+    double tableRate = positions.size() * rounds / tableSec;
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Reachable positions (side to move): " << positions.size() << "\n"
+              << "Table: " << table.size() << " entries, " << table.size() * sizeof(MinimaxEntry) / 1024 << " KB, cold start "
+              << coldMs << " ms\n"
+              << "Mismatches vs search: moves " << moveMismatches << ", values " << valueMismatches << "\n"
+              << std::setprecision(0)
+              << "Recursive search: " << searchRate << " moves/s\n"
+              << "Table lookup:     " << tableRate << " moves/s (" << std::setprecision(1) << tableRate / searchRate << "x)\n"
+              << "Cold start pays for itself after " << std::setprecision(0) << coldMs / 1000.0 * searchRate << " searched moves\n";
+    return (moveMismatches || valueMismatches || checksumTable != checksumSearch * rounds) ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - Hogwild SGD (trainHogwild) scaling from 1 to 16 threads
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_hogwild_bench.exe"  "_tictactoe/test_tic_tac_toe_hogwild_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console -pthread
+
+	__test/test_tic_tac_toe_hogwild_bench.exe [--games <n>] [--max-threads <n>]
+
+	For 1, 2, 4, 8 and 16 threads, trains the same starting network on the same number of
+	games and reports samples/sec and the resulting strength: the share of positions (X
+	opening) where the greedy move is a MINIMAX best move. The games are sampled from the
+	network with every position labelled by the table's best moves (the trainStep outcome
+	target barely moves strength); trainStep games/sec is reported alongside.
+
+*/
+
+#include "tictactoe_bench.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    long long games = 20000;
+    int maxThreads = 16;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc) games = std::atoll(argv[++i]);
+        else if (arg == "--max-threads" && i + 1 < argc) maxThreads = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--games <n>] [--max-threads <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    std::vector<Position> positions = collectPositions();
+
+    gen.seed(5);
+    NeuralNetwork initial(9, 18, 9);
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << ", " << games
+              << " games per run, strength at start " << std::fixed << std::setprecision(3)
+              << strength(initial, positions) << "\n\n"
+              << std::setw(8) << "threads" << std::setw(14) << "samples/s" << std::setw(10) << "scaling"
+              << std::setw(10) << "strength" << std::setw(18) << "trainStep games/s" << "\n";
+
+    // Teacher games, each position learned as it is played
+    auto learnTeacherGame = [](NeuralNetwork& worker, std::mt19937& rng) {
+        int samples = 0;
+        playTeacherGame(worker, rng, [&](const std::vector<double>&, const std::vector<double>& target, double) {
+            worker.backprop(target);
+            samples++;
+        });
+        return samples;
+    };
+    double baseRate = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        NeuralNetwork net = initial;
+        HogwildConfig config;
+        config.threads = threads;
+        config.games = games;
+        config.seed = 1;
+        HogwildStats stats = trainHogwild(net, config, learnTeacherGame);
+        double rate = stats.samples / stats.seconds;
+        if (threads == 1) baseRate = rate;
+
+        NeuralNetwork outcome = initial;
+        config.games = 5000;
+        HogwildStats trainStepStats = trainHogwild(outcome, config);
+
+        std::cout << std::setw(8) << threads << std::setw(14) << std::setprecision(0) << rate << std::setw(9)
+                  << std::setprecision(2) << rate / baseRate << "x" << std::setw(10) << std::setprecision(3)
+                  << strength(net, positions) << std::setw(18) << std::setprecision(0)
+                  << trainStepStats.games / trainStepStats.seconds << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - NeuralNetwork kernels: contiguous SIMD vs nested vectors
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_nn_bench.exe"  "_tictactoe/test_tic_tac_toe_nn_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+	(no -mavx2 -mfma needed: the AVX2/FMA kernels are picked at run time when the CPU has them)
+
+	Compares the former NeuralNetwork (std::vector<std::vector<double>>, copied below as
+	LegacyNeuralNetwork) with NeuralNetworkT<double> and NeuralNetworkT<float> started from the
+	same weights: output agreement, forward+backprop steps/sec and trainStep games/sec.
+
+*/
+
+#include "../include/tictactoe.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ----------------------------
+// Former version
+// ----------------------------
+
+class LegacyNeuralNetwork {
+public:
+ 
+    std::vector<double> input, hidden, output;
+    std::vector<std::vector<double>> weights_ih, weights_ho;
+    std::vector<double> bias_h, bias_o;
+    double learningRate = 0.1;
+
+    LegacyNeuralNetwork(int inputSize, int hiddenSize, int outputSize)
+        : input(inputSize), hidden(hiddenSize), output(outputSize),
+          weights_ih(hiddenSize, std::vector<double>(inputSize)),
+          weights_ho(outputSize, std::vector<double>(hiddenSize)),
+          bias_h(hiddenSize), bias_o(outputSize) {
+
+        // Initialize weights and biases randomly
+        for (auto& row : weights_ih)
+            for (double& w : row)
+                w = dis(gen) * 2.0 - 1.0;
+
+        for (auto& row : weights_ho)
+            for (double& w : row)
+                w = dis(gen) * 2.0 - 1.0;
+
+        for (double& b : bias_h)
+            b = dis(gen) * 2.0 - 1.0;
+
+        for (double& b : bias_o)
+            b = dis(gen) * 2.0 - 1.0;
+    }
+
+	// Sigmoid function
+	double sigmoid(double x) {
+	    return 1.0 / (1.0 + exp(-std::max(-700.0, std::min(700.0, x))));
+	}
+	
+	// Derivative of sigmoid
+	double sigmoidDerivative(double x) {
+	    double s = sigmoid(x);
+	    return s * (1 - s);
+	}
+
+    void forward(const std::vector<double>& x) {
+        input = x;
+        for (size_t i = 0; i < hidden.size(); ++i) {
+            double activation = bias_h[i];
+            for (size_t j = 0; j < input.size(); ++j) {
+                activation += weights_ih[i][j] * input[j];
+            }
+            hidden[i] = sigmoid(activation);
+        }
+
+        for (size_t i = 0; i < output.size(); ++i) {
+            double activation = bias_o[i];
+            for (size_t j = 0; j < hidden.size(); ++j) {
+                activation += weights_ho[i][j] * hidden[j];
+            }
+            output[i] = sigmoid(activation);
+        }
+    }
+
+    void backprop(const std::vector<double>& target) {
+        std::vector<double> outputError(output.size());
+        std::vector<double> hiddenError(hidden.size());
+
+        // Output layer gradients
+        std::vector<double> grad_output(output.size());
+        for (size_t i = 0; i < output.size(); ++i) {
+            double error = target[i] - output[i];
+            grad_output[i] = error * sigmoidDerivative(output[i]);
+        }
+
+        // Hidden layer gradients
+        std::vector<double> grad_hidden(hidden.size(), 0);
+        for (size_t i = 0; i < hidden.size(); ++i) {
+            for (size_t j = 0; j < output.size(); ++j) {
+                grad_hidden[i] += grad_output[j] * weights_ho[j][i];
+            }
+            grad_hidden[i] *= sigmoidDerivative(hidden[i]);
+        }
+
+        // Update weights and biases (output layer)
+        for (size_t i = 0; i < output.size(); ++i) {
+            bias_o[i] += learningRate * grad_output[i];
+            for (size_t j = 0; j < hidden.size(); ++j) {
+                weights_ho[i][j] += learningRate * grad_output[i] * hidden[j];
+            }
+        }
+
+        // Update weights and biases (hidden layer)
+        for (size_t i = 0; i < hidden.size(); ++i) {
+            bias_h[i] += learningRate * grad_hidden[i];
+            for (size_t j = 0; j < input.size(); ++j) {
+                weights_ih[i][j] += learningRate * grad_hidden[i] * input[j];
+            }
+        }
+    }
+};
+
+// trainStep as in tictactoe.h, for the legacy network
+void legacyTrainStep(LegacyNeuralNetwork& net) {
+    TicTacToeBits game;
+    std::vector<double> input;
+    int plies = 0;
+
+    int turn = 1;
+    while (true) {
+        boardToInput(game, input);
+        net.forward(input);
+
+        if (game.emptyMask() == 0) break;
+
+        int move = selectMove(net.output, game);
+        plies++;
+        game.play(move, turn);
+
+        int winner;
+        if (game.isGameOver(winner)) {
+            std::vector<double> target(9, 0.0);
+            int mover = (turn == 1) ? winner : -winner;
+            if (mover == 1) target[move] = 1.0;
+            else if (mover == -1) target[move] = -1.0;
+            else target[move] = 0.5;
+            for (int i = 0; i < plies; ++i) net.backprop(target);
+            break;
+        }
+        turn = -turn;
+    }
+}
+
+// ----------------------------
+// Checks and timing
+// ----------------------------
+
+template <typename Fn>
+double ratePerSec(int count, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) fn(i);
+    return count / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Net>
+double maxOutputDiff(Net& net, LegacyNeuralNetwork& legacy, const std::vector<std::vector<double>>& inputs) {
+    double diff = 0.0;
+    for (const auto& x : inputs) {
+        net.forward(x);
+        legacy.forward(x);
+        for (int i = 0; i < 9; ++i) diff = std::max(diff, std::abs(net.output[i] - legacy.output[i]));
+    }
+    return diff;
+}
+
+void report(const char* name, double legacyRate, double doubleRate, double floatRate) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << legacyRate << std::setw(12) << doubleRate << std::setw(12) << floatRate
+              << std::setprecision(1) << std::setw(9) << doubleRate / legacyRate << "x"
+              << std::setw(9) << floatRate / legacyRate << "x\n";
+}
+
+int main() {
+#ifdef NN_HAS_AVX2_KERNEL
+    std::cout << "Kernels: " << (nnHasAvx2() ? "AVX2/FMA" : "scalar (CPU without AVX2/FMA)") << "\n";
+#else
+    std::cout << "Kernels: scalar\n";
+#endif
+
+    // Same seed -> same initial weights in all three networks
+    gen.seed(7);
+    LegacyNeuralNetwork legacy(9, 18, 9);
+    gen.seed(7);
+    NeuralNetworkT<double> netDouble(9, 18, 9);
+    gen.seed(7);
+    NeuralNetworkT<float> netFloat(9, 18, 9);
+
+    std::vector<std::vector<double>> inputs(4096, std::vector<double>(9));
+    std::vector<std::vector<double>> targets(4096, std::vector<double>(9, 0.0));
+    for (size_t n = 0; n < inputs.size(); ++n) {
+        for (double& v : inputs[n]) v = static_cast<double>(moveDis(gen) % 3) - 1.0;
+        targets[n][moveDis(gen)] = 1.0;
+    }
+
+    double diffDouble = maxOutputDiff(netDouble, legacy, inputs);
+    double diffFloat = maxOutputDiff(netFloat, legacy, inputs);
+
+    // One training step on each, then compare again
+    legacy.forward(inputs[0]);    legacy.backprop(targets[0]);
+    netDouble.forward(inputs[0]); netDouble.backprop(targets[0]);
+    netFloat.forward(inputs[0]);  netFloat.backprop(targets[0]);
+    double stepDouble = maxOutputDiff(netDouble, legacy, inputs);
+    double stepFloat = maxOutputDiff(netFloat, legacy, inputs);
+
+    std::cout << std::scientific << std::setprecision(2)
+              << "Max |output - legacy| on " << inputs.size() << " boards: double " << diffDouble << ", float " << diffFloat << "\n"
+              << "                 after one backprop: double " << stepDouble << ", float " << stepFloat << "\n\n";
+
+    const int steps = 400000, games = 100000;
+    auto step = [&](auto& net) {
+        return ratePerSec(steps, [&](int i) {
+            net.forward(inputs[i & 4095]);
+            net.backprop(targets[i & 4095]);
+        });
+    };
+    double stepLegacy = step(legacy), stepD = step(netDouble), stepF = step(netFloat);
+
+    double gamesLegacy = ratePerSec(games, [&](int) { legacyTrainStep(legacy); });
+    double gamesDouble = ratePerSec(games, [&](int) { trainStep(netDouble); });
+    double gamesFloat = ratePerSec(games, [&](int) { trainStep(netFloat); });
+
+    std::cout << std::left << std::setw(24) << "per second" << std::right << std::setw(12) << "legacy"
+              << std::setw(12) << "double" << std::setw(12) << "float" << std::setw(20) << "speedup (d / f)" << "\n";
+    report("forward+backprop", stepLegacy, stepD, stepF);
+    report("trainStep games", gamesLegacy, gamesDouble, gamesFloat);
+
+    return (diffDouble > 1e-9 || stepDouble > 1e-9 || diffFloat > 1e-4) ? 1 : 0;
+}
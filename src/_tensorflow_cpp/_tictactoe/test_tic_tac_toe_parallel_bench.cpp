@@ -0,0 +1,137 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - actor/learner training (trainParallel) vs the serial trainStep loop
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_parallel_bench.exe"  "_tictactoe/test_tic_tac_toe_parallel_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console -pthread
+
+	__test/test_tic_tac_toe_parallel_bench.exe [--actors <n>] [--batch <size>] [--target <agreement>] [--max-games <n>] [--seeds <n>]
+
+	Strength is the share of positions (X opening) where the greedy move is a MINIMAX best move.
+	First plays the 5,000 trainStep games of TicTacToeModelRegistry::TrainStandalone serially and
+	through trainParallel from --seeds initial networks (default 10) and reports the mean and
+	spread of the strength each reaches. The outcome target barely moves that figure, so the
+	time to a given strength is measured with a teacher: games sampled from the network, every
+	position labelled with the table's best moves, learned per sample (serial) or by the learner.
+
+*/
+
+#include "tictactoe_bench.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    int actors = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    int batchSize = 32, maxGames = 200000, seeds = 10;
+    double target = 0.62;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--actors" && i + 1 < argc) actors = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--batch" && i + 1 < argc) batchSize = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--target" && i + 1 < argc) target = std::atof(argv[++i]);
+        else if (arg == "--max-games" && i + 1 < argc) maxGames = std::atoi(argv[++i]);
+        else if (arg == "--seeds" && i + 1 < argc) seeds = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--actors <n>] [--batch <size>] [--target <agreement>] [--max-games <n>] [--seeds <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    std::vector<Position> positions = collectPositions();
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << ", actors: " << actors
+              << ", batch: " << batchSize << "\n\n";
+
+    // The 5,000 trainStep games, from 'seeds' different initial networks
+    std::vector<double> startStrength, serialStrengths, parallelStrengths;
+    double serialMs = 0, parallelMs = 0;
+    std::cout << "5000 trainStep games, strength per initial network\n"
+              << "  seed     start    serial  parallel\n";
+    for (int s = 1; s <= seeds; ++s) {
+        gen.seed(s);
+        NeuralNetwork start(9, 18, 9);
+        NeuralNetwork serial = start, parallel = start;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int g = 0; g < 5000; ++g) trainStep(serial);
+        serialMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+        ParallelTrainingConfig config;
+        config.games = 5000;
+        config.actors = actors;
+        config.batchSize = batchSize;
+        config.seed = s;
+        parallelMs += trainParallel(parallel, config).seconds * 1000;
+
+        startStrength.push_back(strength(start, positions));
+        serialStrengths.push_back(strength(serial, positions));
+        parallelStrengths.push_back(strength(parallel, positions));
+        std::cout << std::fixed << std::setprecision(3) << "  " << std::setw(4) << s << "  " << std::setw(8)
+                  << startStrength.back() << "  " << std::setw(8) << serialStrengths.back() << "  " << std::setw(8)
+                  << parallelStrengths.back() << "\n";
+    }
+    auto summary = [](const std::vector<double>& v) {
+        double mean = 0, var = 0;
+        for (double x : v) mean += x;
+        mean /= v.size();
+        for (double x : v) var += (x - mean) * (x - mean);
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(3) << mean << " +/- "
+            << (v.size() > 1 ? std::sqrt(var / (v.size() - 1)) : 0.0);
+        return out.str();
+    };
+    std::cout << "  mean +/- sd over " << seeds << " networks: start " << summary(startStrength) << ", serial "
+              << summary(serialStrengths) << ", parallel " << summary(parallelStrengths) << "\n"
+              << std::setprecision(1) << "  time per run: serial " << serialMs / seeds << " ms, parallel "
+              << parallelMs / seeds << " ms\n\n";
+
+    gen.seed(5);
+    NeuralNetwork initial(9, 18, 9);
+
+    // Time to reach 'target' with teacher labels
+    std::cout << std::setprecision(3) << "Time to strength " << target << " (teacher labels, checked every 200 games)\n";
+    int serialGames = 0;
+    double serialSec = 0, serialStrength = 0;
+    {
+        NeuralNetwork net = initial;
+        std::mt19937 rng(1);
+        auto emit = [&](const std::vector<double>&, const std::vector<double>& t, double) { net.backprop(t); };
+        auto start = std::chrono::steady_clock::now();
+        while (serialGames < maxGames) {
+            playTeacherGame(net, rng, emit);
+            if (++serialGames % 200 == 0 && (serialStrength = strength(net, positions)) >= target) break;
+        }
+        serialSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    std::cout << std::setprecision(3) << "  serial:   " << serialSec << " s, " << serialGames << " games, strength "
+              << serialStrength << (serialStrength < target ? " (not reached)" : "") << "\n";
+
+    NeuralNetwork net = initial;
+    ParallelTrainingConfig config;
+    config.games = maxGames;
+    config.actors = actors;
+    config.batchSize = batchSize;
+    config.seed = 1;
+    double parallelStrength = 0;
+    long long samplesAtCheck = 0, samples = 0;
+    ParallelTrainingStats stats = trainParallel(net, config,
+        [](NeuralNetwork& local, std::mt19937& rng, auto& emit) { playTeacherGame(local, rng, emit); },
+        [&](const NeuralNetwork& learner) {
+            // About every 200 games' worth of samples (~7.5 positions per game)
+            samples += batchSize;
+            if (samples - samplesAtCheck < 1500) return true;
+            samplesAtCheck = samples;
+            return (parallelStrength = strength(learner, positions)) < target;
+        });
+    std::cout << "  parallel: " << stats.seconds << " s, " << stats.games << " games, strength " << parallelStrength
+              << (parallelStrength < target ? " (not reached)" : "") << " (" << std::setprecision(2)
+              << serialSec / stats.seconds << "x)\n";
+    return 0;
+}
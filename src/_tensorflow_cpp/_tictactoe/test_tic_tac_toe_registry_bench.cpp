@@ -0,0 +1,194 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - games/sec through PlayTicTacToeGameWithHistory, per-call model
+	== loading vs TicTacToeModelRegistry
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_registry_bench.exe"  "_tictactoe/test_tic_tac_toe_registry_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console -pthread
+
+	__test/test_tic_tac_toe_registry_bench.exe [--tensorflow] [--threads <n>]
+
+	Runs in a scratch directory. First the cold start with no tictactoe_model.txt: the former
+	RunTicTacToeSelfPlay (copied below) trains inside the game, the registry refuses the game
+	until TrainStandalone (the DLL's TrainTicTacToeModel) has run, outside any game. Then
+	games/sec per AI mode with the model file present, and through the registry from several
+	threads. --tensorflow adds TENSORFLOW mode (needs
+	tictactoe_tf_model in the working directory; it is linked into the scratch directory).
+	Both paths are called through the same wrapper as the DLL's PlayTicTacToeGameWithHistory.
+
+*/
+
+#include "../include/tictactoe.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------------------------
+// Former version: models loaded per call
+// ----------------------------
+
+bool LegacyRunTicTacToeSelfPlay(TicTacToeResultOnline& result, int aiMode, double temperature) {
+    TensorFlowTicTacToe tf;
+    NeuralNetwork netStandalone(9, 18, 9);
+    TicTacToeBits game;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> starter(0, 1);
+    int turn = (starter(gen) == 0) ? 1 : -1;
+
+    int winner = 0, move = -1, moveCount = 0;
+    std::vector<double> input;
+    game.toArray(result.history[0]);
+    result.historyCount = 1;
+
+    if (aiMode == TENSORFLOW) {
+        if (!tf.LoadModel("tictactoe_tf_model")) return false;
+    } else if (aiMode != MINIMAX && !netStandalone.loadModel("tictactoe_model.txt")) {
+        for (int i = 0; i < 5000; ++i) trainStep(netStandalone);
+        netStandalone.saveModel("tictactoe_model.txt");
+    }
+
+    while (true) {
+        if (aiMode == TENSORFLOW) {
+            float cells[9];
+            for (int i = 0; i < 9; ++i) cells[i] = static_cast<float>(game.at(i));
+            if (!tf.PredictBestMove(cells, move)) return false;
+        } else if (aiMode == MINIMAX) {
+            move = minimaxMove(game, turn);
+        } else {
+            boardToInput(game, input);
+            netStandalone.forward(input);
+            move = selectMove(netStandalone.output, game, aiMode, temperature);
+        }
+        if (move < 0 || move >= 9 || !game.isEmpty(move)) {
+            if (game.emptyMask() == 0) break;
+            move = TicTacToeBits::lowestCell(game.emptyMask());
+        }
+        game.play(move, turn);
+        result.moves[moveCount++] = move;
+        if (result.historyCount < 10) game.toArray(result.history[result.historyCount++]);
+        if (game.isGameOver(winner)) break;
+        turn = -turn;
+    }
+
+    result.winner = winner;
+    game.toArray(result.finalBoard);
+    for (int i = moveCount; i < 9; ++i) result.moves[i] = -1;
+    result.moveCount = moveCount;
+    return true;
+}
+
+// Body of the DLL entry point (_tensorflow/tensorFlowApp.cpp)
+template <typename RunFn>
+bool playThroughEntryPoint(RunFn run, TicTacToeResultOnline* result, int aiMode, double temperature) {
+    try {
+        if (!result) return false;
+        return run(*result, aiMode, temperature);
+    } catch (...) {
+        return false;
+    }
+}
+
+template <typename RunFn>
+double gamesPerSec(RunFn run, int aiMode, double seconds) {
+    TicTacToeResultOnline result;
+    long long games = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    do {
+        for (int i = 0; i < 16; ++i)
+            if (!playThroughEntryPoint(run, &result, aiMode, 1.0)) return 0;
+        games += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < seconds);
+    return games / elapsed;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    bool withTensorFlow = false;
+    int threads = 4;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--tensorflow") withTensorFlow = true;
+        else if (arg == "--threads" && i + 1 < argc) threads = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--tensorflow] [--threads <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    namespace fs = std::filesystem;
+    const fs::path home = fs::current_path();
+    const fs::path scratch = fs::temp_directory_path() / "tictactoe_registry_bench";
+    fs::remove_all(scratch);
+    fs::create_directories(scratch);
+    if (withTensorFlow) fs::create_directory_symlink(fs::absolute(TICTACTOE_TF_MODEL_DIR), scratch / TICTACTOE_TF_MODEL_DIR);
+    fs::current_path(scratch);
+
+    auto legacy = [](TicTacToeResultOnline& r, int mode, double t) { return LegacyRunTicTacToeSelfPlay(r, mode, t); };
+    auto registry = [](TicTacToeResultOnline& r, int mode, double t) { return RunTicTacToeSelfPlay(r, mode, t); };
+    TicTacToeResultOnline result;
+
+    // Cold start, no model file
+    auto start = std::chrono::steady_clock::now();
+    playThroughEntryPoint(legacy, &result, EXPERT, 1.0);
+    double legacyFirst = millisecondsSince(start);
+    fs::remove(TICTACTOE_MODEL_FILE);
+
+    start = std::chrono::steady_clock::now();
+    bool untrainedPlayed = playThroughEntryPoint(registry, &result, EXPERT, 1.0);
+    double registryUntrained = millisecondsSince(start);
+    start = std::chrono::steady_clock::now();
+    TicTacToeModelRegistry::Instance().TrainStandalone();
+    double registryTrain = millisecondsSince(start);
+    start = std::chrono::steady_clock::now();
+    playThroughEntryPoint(registry, &result, EXPERT, 1.0);
+    double registryFirst = millisecondsSince(start);
+
+    std::cout << std::fixed << std::setprecision(2) << "Cold start without " << TICTACTOE_MODEL_FILE << "\n"
+              << "  per-call loading: first game " << legacyFirst << " ms (trains inline)\n"
+              << "  registry:         game before training " << registryUntrained << " ms ("
+              << (untrainedPlayed ? "PLAYED" : "refused") << "), TrainStandalone " << registryTrain
+              << " ms, first game " << registryFirst << " ms\n\n";
+
+    // Steady state, model file present (the registry's trained model, saved above)
+    struct Mode { int id; const char* name; };
+    std::vector<Mode> modes = {{EXPERT, "EXPERT"}, {CREATIVE, "CREATIVE"}, {RANDOM, "RANDOM"}, {MINIMAX, "MINIMAX"}};
+    if (withTensorFlow) modes.push_back({TENSORFLOW, "TENSORFLOW"});
+    std::cout << std::left << std::setw(12) << "games/s" << std::right << std::setw(18) << "per-call loading"
+              << std::setw(12) << "registry" << std::setw(10) << "speedup" << "\n";
+    for (const auto& mode : modes) {
+        double before = gamesPerSec(legacy, mode.id, 1.0);
+        double after = gamesPerSec(registry, mode.id, 1.0);
+        std::cout << std::left << std::setw(12) << mode.name << std::right << std::setprecision(0) << std::setw(18)
+                  << before << std::setw(12) << after << std::setw(9) << std::setprecision(1)
+                  << (before > 0 ? after / before : 0.0) << "x\n";
+    }
+
+    // Registry from several threads at once
+    std::vector<double> rates(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+        workers.emplace_back([&, t] { rates[t] = gamesPerSec(registry, EXPERT, 1.0); });
+    for (auto& w : workers) w.join();
+    double total = 0;
+    for (double r : rates) total += r;
+    std::cout << "\nRegistry, EXPERT, " << threads << " threads: " << std::setprecision(0) << total
+              << " games/s in total (hardware threads: " << std::thread::hardware_concurrency() << ")\n";
+
+    fs::current_path(home);
+    fs::remove_all(scratch);
+    return untrainedPlayed ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - bitboard self-play vs int-vector self-play
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_selfplay_bench.exe"  "_tictactoe/test_tic_tac_toe_selfplay_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console
+
+	Runs trainStep and RunTicTacToeSelfPlay next to copies of their former std::vector<int>
+	versions (legacy*, below), checks that both train identical weights and play identical
+	MINIMAX games, and reports self-play games/sec for each. Run next to tictactoe_model.txt
+	so the former EXPERT games load the model instead of training one per game.
+
+*/
+
+#include "../include/tictactoe.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// ----------------------------
+// Former versions (TicTacToe board as std::vector<int>)
+// ----------------------------
+
+void legacyTrainStep(NeuralNetwork& net) {
+    TicTacToe game;
+    std::vector<std::pair<std::vector<double>, std::vector<double>>> history;
+
+    int turn = 1;
+    while (true) {
+        std::vector<double> input = boardToInput(game.board);
+        net.forward(input);
+
+        auto validMoves = game.getValidMoves();
+        if (validMoves.empty()) break;
+
+        int move = selectMove(net.output, game);
+        history.push_back({input, net.output});
+        game.board[move] = turn;
+
+        int winner;
+        if (game.isGameOver(winner)) {
+            for (size_t i = 0; i < history.size(); ++i) {
+                std::vector<double> target(9, 0.0);
+                if (turn == 1) {
+                    if (winner == 1) target[move] = 1.0;
+                    else if (winner == -1) target[move] = -1.0;
+                    else target[move] = 0.5;
+                } else {
+                    if (winner == -1) target[move] = 1.0;
+                    else if (winner == 1) target[move] = -1.0;
+                    else target[move] = 0.5;
+                }
+                net.backprop(target);
+            }
+            break;
+        }
+        turn = -turn;
+    }
+}
+
+// Game loop of the former RunTicTacToeSelfPlay (TENSORFLOW mode left out)
+bool legacyRunSelfPlay(TicTacToeResultOnline& result, int aiMode, double temperature) {
+    NeuralNetwork netStandalone(9, 18, 9);
+    TicTacToe game;
+
+    std::random_device              rd;
+    std::mt19937                    gen(rd());
+    std::uniform_int_distribution<> starter(0, 1);
+    int                             turn = (starter(gen) == 0) ? 1 : -1;
+
+    int              winner = 0;
+    int              move = -1;
+    std::vector<int> moves;
+
+    for (int i = 0; i < 9; ++i) result.history[0][i] = game.board[i];
+    result.historyCount = 1;
+
+    const std::string modelFile = "tictactoe_model.txt";
+    if (aiMode != MINIMAX && !netStandalone.loadModel(modelFile)) {
+        for (int i = 0; i < 5000; ++i) trainStep(netStandalone);
+        netStandalone.saveModel(modelFile);
+    }
+
+    while (true) {
+        if (aiMode == MINIMAX) {
+            move = minimaxMove(game.board, turn);
+        } else {
+            std::vector<double> input = boardToInput(game.board);
+            netStandalone.forward(input);
+            move = selectMove(netStandalone.output, game, aiMode, temperature);
+        }
+
+        if (move < 0 || move >= 9 || game.board[move] != 0) {
+            auto valid = game.getValidMoves();
+            if (valid.empty()) break;
+            move = valid[0];
+        }
+
+        game.board[move] = turn;
+        moves.push_back(move);
+
+        if (result.historyCount < 10) {
+            for (int i = 0; i < 9; ++i) result.history[result.historyCount][i] = game.board[i];
+            result.historyCount++;
+        }
+
+        if (game.isGameOver(winner)) break;
+        turn = -turn;
+    }
+
+    result.winner = winner;
+    for (int i = 0; i < 9; ++i) {
+        result.finalBoard[i] = game.board[i];
+        result.moves[i] = (i < static_cast<int>(moves.size())) ? moves[i] : -1;
+    }
+    result.moveCount = static_cast<int>(moves.size());
+    return true;
+}
+
+// ----------------------------
+// Checks and timing
+// ----------------------------
+
+bool sameWeights(const NeuralNetwork& a, const NeuralNetwork& b) {
+    return a.weights_ih == b.weights_ih && a.weights_ho == b.weights_ho && a.bias_h == b.bias_h && a.bias_o == b.bias_o;
+}
+
+// Every game-tree node (either side opening): bitboard win detection and move list agree with TicTacToe
+int checkGameLogic(TicTacToe& game, int player, int& positions) {
+    int mismatches = 0;
+    TicTacToeBits bits = TicTacToeBits::fromArray(game.board.data());
+    int w1, w2;
+    bool over1 = game.isGameOver(w1), over2 = bits.isGameOver(w2);
+    int valid[9];
+    int count = bits.validMoves(valid);
+    auto expected = game.getValidMoves();
+    if (over1 != over2 || w1 != w2 || std::vector<int>(valid, valid + count) != expected ||
+        bits.code() != encodeBoard(game.board.data()))
+        mismatches++;
+    positions++;
+    if (over1) return mismatches;
+    for (int cell : expected) {
+        game.board[cell] = player;
+        mismatches += checkGameLogic(game, -player, positions);
+        game.board[cell] = 0;
+    }
+    return mismatches;
+}
+
+template <typename Fn>
+double gamesPerSec(int games, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < games; ++i) fn();
+    return games / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, double legacyRate, double bitsRate) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << legacyRate << std::setw(12) << bitsRate
+              << std::setw(9) << std::setprecision(2) << bitsRate / legacyRate << "x\n";
+}
+
+int main() {
+    int positions = 0;
+    TicTacToe root;
+    int logicMismatches = checkGameLogic(root, 1, positions) + checkGameLogic(root, -1, positions);
+
+    // Same starting weights -> same games -> bit-identical weights afterwards
+    const int trainGames = 20000;
+    NeuralNetwork netLegacy(9, 18, 9);
+    NeuralNetwork netBits = netLegacy;
+    double trainLegacy = gamesPerSec(trainGames, [&] { legacyTrainStep(netLegacy); });
+    double trainBits = gamesPerSec(trainGames, [&] { trainStep(netBits); });
+    bool trainSame = sameWeights(netLegacy, netBits);
+
+    // MINIMAX is deterministic once the opening side is fixed; compare game records
+    int minimaxMismatches = 0;
+    for (int g = 0; g < 200; ++g) {
+        TicTacToeResultOnline a{}, b{};
+        legacyRunSelfPlay(a, MINIMAX, 1.0);
+        int starter = a.history[1][a.moves[0]];
+        do RunTicTacToeSelfPlay(b, MINIMAX, 1.0); while (b.history[1][b.moves[0]] != starter);
+        if (std::memcmp(&a, &b, sizeof(a)) != 0) minimaxMismatches++;
+    }
+
+    // RunTicTacToeSelfPlay never trains; a no-op when tictactoe_model.txt is present
+    TicTacToeModelRegistry::Instance().TrainStandalone();
+    const int playGames = 20000, modelGames = 500;
+    TicTacToeResultOnline result{};
+    double minimaxLegacy = gamesPerSec(playGames, [&] { legacyRunSelfPlay(result, MINIMAX, 1.0); });
+    double minimaxBits = gamesPerSec(playGames, [&] { RunTicTacToeSelfPlay(result, MINIMAX, 1.0); });
+    double expertLegacy = gamesPerSec(modelGames, [&] { legacyRunSelfPlay(result, EXPERT, 1.0); });
+    double expertBits = gamesPerSec(modelGames, [&] { RunTicTacToeSelfPlay(result, EXPERT, 1.0); });
+
+    std::cout << "Game-tree nodes checked: " << positions << ", game logic mismatches: " << logicMismatches << "\n"
+              << "trainStep weights identical after " << trainGames << " games: " << (trainSame ? "yes" : "NO") << "\n"
+              << "MINIMAX game record mismatches: " << minimaxMismatches << "\n\n"
+              << std::left << std::setw(28) << "games/sec" << std::right
+              << std::setw(12) << "vector" << std::setw(12) << "bitboard" << std::setw(10) << "speedup" << "\n";
+    report("trainStep", trainLegacy, trainBits);
+    report("RunTicTacToeSelfPlay MINIMAX", minimaxLegacy, minimaxBits);
+    report("RunTicTacToeSelfPlay EXPERT", expertLegacy, expertBits);
+    std::cout << "(the former loop loads tictactoe_model.txt on every call; RunTicTacToeSelfPlay now loads it once,\n"
+                 " see test_tic_tac_toe_registry_bench.cpp)\n";
+
+    return (logicMismatches || !trainSame || minimaxMismatches) ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+/*
+
+	=====================================================================================
+	== tic tac toe - TensorFlowTicTacToe::PredictBestMove overhead outside TF_SessionRun
+	=====================================================================================
+
+	execute from root (above _tictactoe folder):
+
+	g++ -std=c++20 -O2 -I"include" -L"lib" -o "__test/test_tic_tac_toe_tf_bench.exe"  "_tictactoe/test_tic_tac_toe_tf_bench.cpp" -ltensorflow -m64 -Wl,--subsystem,console -pthread
+
+	__test/test_tic_tac_toe_tf_bench.exe [--predictions <n>] [--rounds <n>]
+
+	Needs tictactoe_tf_model in the working directory. Times the same positions through
+	the former PredictBestMove (copied below: names looked up, tensors and vectors allocated
+	per call), the current one and a bare TF_SessionRun on prebuilt tensors. The overhead
+	per prediction is each path's time minus the bare run; best of --rounds.
+
+*/
+
+#include "../include/tictactoe.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ----------------------------
+// Former version: per-call lookups and allocations
+// ----------------------------
+
+bool LegacyPredictBestMove(TensorFlowTicTacToe& tf, const float input_board[9], int& best_move) {
+    if (!tf.session) return false;
+    std::unique_ptr<TF_Status, void (*)(TF_Status*)> runStatus(TF_NewStatus(), TF_DeleteStatus);
+
+    int64_t input_dims[] = {1, 9};
+    TF_Tensor* input_tensor = TF_AllocateTensor(TF_FLOAT, input_dims, 2, sizeof(float) * 9);
+    float* input_data = static_cast<float*>(TF_TensorData(input_tensor));
+    for (int i = 0; i < 9; ++i) input_data[i] = input_board[i];
+
+    TF_Tensor* output_tensor = nullptr;
+    TF_Output inputs[1] = {{TF_GraphOperationByName(tf.graph, TensorFlowTicTacToe::INPUT_NAME), 0}};
+    TF_Output outputs[1] = {{TF_GraphOperationByName(tf.graph, TensorFlowTicTacToe::OUTPUT_NAME), 0}};
+    if (!inputs[0].oper || !outputs[0].oper) {
+        TF_DeleteTensor(input_tensor);
+        return false;
+    }
+
+    TF_SessionRun(tf.session, nullptr, inputs, &input_tensor, 1, outputs, &output_tensor, 1, nullptr, 0, nullptr,
+                  runStatus.get());
+    if (TF_GetCode(runStatus.get()) != TF_OK) {
+        TF_DeleteTensor(input_tensor);
+        return false;
+    }
+
+    float* probs = static_cast<float*>(TF_TensorData(output_tensor));
+    std::vector<int> validMoves;
+    for (int i = 0; i < 9; ++i)
+        if (input_board[i] == 0.0f) validMoves.push_back(i);
+    if (validMoves.empty()) {
+        TF_DeleteTensor(input_tensor);
+        TF_DeleteTensor(output_tensor);
+        return false;
+    }
+
+    const float temperature = 1.5f;
+    std::vector<float> exp_probs;
+    float sum = 0.0f;
+    for (int idx : validMoves) {
+        float p = std::exp(probs[idx] / temperature);
+        exp_probs.push_back(p);
+        sum += p;
+    }
+    for (float& p : exp_probs) p /= sum;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::discrete_distribution<> dist(exp_probs.begin(), exp_probs.end());
+    best_move = validMoves[dist(gen)];
+
+    TF_DeleteTensor(input_tensor);
+    TF_DeleteTensor(output_tensor);
+    return true;
+}
+
+// Positions from random games, as the self-play loop feeds them
+std::vector<std::array<float, 9>> randomPositions(int count) {
+    std::mt19937 rng(3);
+    std::vector<std::array<float, 9>> positions;
+    while (static_cast<int>(positions.size()) < count) {
+        TicTacToeBits game;
+        int turn = 1, winner;
+        while (!game.isGameOver(winner) && static_cast<int>(positions.size()) < count) {
+            std::array<float, 9> cells;
+            for (int i = 0; i < 9; ++i) cells[i] = static_cast<float>(game.at(i));
+            positions.push_back(cells);
+            std::vector<int> empty;
+            for (int i = 0; i < 9; ++i)
+                if (game.isEmpty(i)) empty.push_back(i);
+            game.play(empty[std::uniform_int_distribution<>(0, static_cast<int>(empty.size()) - 1)(rng)], turn);
+            turn = -turn;
+        }
+    }
+    return positions;
+}
+
+// Best of 'rounds' microseconds per call
+template <typename Fn>
+double microsecondsPerCall(Fn&& fn, int calls, int rounds) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < calls; ++i) fn(i);
+        best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / calls);
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int predictions = 20000, rounds = 5;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--predictions" && i + 1 < argc) predictions = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--rounds" && i + 1 < argc) rounds = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cout << "Usage: " << argv[0] << " [--predictions <n>] [--rounds <n>]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    TensorFlowTicTacToe tf;
+    if (!tf.LoadModel(TICTACTOE_TF_MODEL_DIR)) return 1;
+    std::vector<std::array<float, 9>> positions = randomPositions(predictions);
+
+    // Bare TF_SessionRun: ops resolved and input tensor built once, output freed
+    TF_Output input = {TF_GraphOperationByName(tf.graph, TensorFlowTicTacToe::INPUT_NAME), 0};
+    TF_Output output = {TF_GraphOperationByName(tf.graph, TensorFlowTicTacToe::OUTPUT_NAME), 0};
+    int64_t dims[] = {1, 9};
+    TF_Tensor* inputTensor = TF_AllocateTensor(TF_FLOAT, dims, 2, sizeof(float) * 9);
+    TF_Status* status = TF_NewStatus();
+    double bare = microsecondsPerCall([&](int i) {
+        std::memcpy(TF_TensorData(inputTensor), positions[i].data(), sizeof(float) * 9);
+        TF_Tensor* outputTensor = nullptr;
+        TF_SessionRun(tf.session, nullptr, &input, &inputTensor, 1, &output, &outputTensor, 1, nullptr, 0, nullptr, status);
+        TF_DeleteTensor(outputTensor);
+    }, predictions, rounds);
+    TF_DeleteTensor(inputTensor);
+    TF_DeleteStatus(status);
+
+    int move, invalid = 0;
+    double legacy = microsecondsPerCall([&](int i) {
+        if (!LegacyPredictBestMove(tf, positions[i].data(), move) || positions[i][move] != 0.0f) invalid++;
+    }, predictions, rounds);
+    double current = microsecondsPerCall([&](int i) {
+        if (!tf.PredictBestMove(positions[i].data(), move) || positions[i][move] != 0.0f) invalid++;
+    }, predictions, rounds);
+
+    std::cout << std::fixed << std::setprecision(2) << predictions << " predictions, best of " << rounds << "\n"
+              << std::left << std::setw(18) << "" << std::right << std::setw(10) << "us/call" << std::setw(14)
+              << "overhead us" << "\n"
+              << std::left << std::setw(18) << "TF_SessionRun" << std::right << std::setw(10) << bare << "\n"
+              << std::left << std::setw(18) << "former predict" << std::right << std::setw(10) << legacy
+              << std::setw(14) << legacy - bare << "\n"
+              << std::left << std::setw(18) << "PredictBestMove" << std::right << std::setw(10) << current
+              << std::setw(14) << current - bare << "\n"
+              << "Invalid or failed predictions: " << invalid << "\n";
+    return invalid ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+#ifndef TICTACTOE_BENCH_H
+#define TICTACTOE_BENCH_H
+
+// Helpers shared by the tic tac toe benches: the reachable positions labelled by the MINIMAX
+// table, the strength of a network on them, and teacher-labelled self-play games.
+
+#include "../include/tictactoe.h"
+#include <set>
+#include <utility>
+#include <vector>
+
+struct Position {
+    std::vector<int> board;
+    int player;                 // side to move
+    std::vector<double> input;  // boardToInput(board)
+    std::vector<double> target; // 1 on every MINIMAX best move, 0 elsewhere
+    uint16_t bestMoves;
+};
+
+// Positions reachable in play from 'board' with 'player' to move, each once
+void collectPositions(std::vector<int>& board, int player, std::set<std::pair<int, int>>& seen,
+                      std::vector<Position>& out) {
+    if (!seen.insert({encodeBoard(board.data()), player}).second) return;
+    TicTacToe game;
+    game.board = board;
+    int winner;
+    if (game.isGameOver(winner)) return;
+
+    Position p{board, player, boardToInput(board), std::vector<double>(9, 0.0),
+               minimaxLookup(board.data(), player).bestMoves};
+    for (int i = 0; i < 9; ++i)
+        if (p.bestMoves & (1u << i)) p.target[i] = 1.0;
+    out.push_back(std::move(p));
+
+    for (int i = 0; i < 9; ++i) {
+        if (board[i] != 0) continue;
+        board[i] = player;
+        collectPositions(board, -player, seen, out);
+        board[i] = 0;
+    }
+}
+
+// The positions reachable with X opening
+std::vector<Position> collectPositions() {
+    std::vector<Position> positions;
+    std::set<std::pair<int, int>> seen;
+    std::vector<int> empty(9, 0);
+    collectPositions(empty, 1, seen, positions);
+    return positions;
+}
+
+// Share of positions where the greedy move is a MINIMAX best move. Copies the weights so
+// the caller's scratch (a learner's, say) isn't disturbed.
+template <typename T>
+double strength(const NeuralNetworkT<T>& trained, const std::vector<Position>& positions) {
+    NeuralNetworkT<T> net = trained;
+    int agree = 0;
+    for (const auto& p : positions) {
+        net.forward(p.input);
+        TicTacToe game;
+        game.board = p.board;
+        agree += (p.bestMoves >> selectMove(net.output, game)) & 1;
+    }
+    return static_cast<double>(agree) / positions.size();
+}
+
+// One game with moves sampled from the network; each position is passed to
+// emit(input, target, weight) with the table's best moves as target, before the move is drawn
+template <typename Emit>
+void playTeacherGame(NeuralNetwork& net, std::mt19937& rng, Emit&& emit) {
+    TicTacToeBits game;
+    std::vector<double> input, target(9);
+    std::vector<int> cells(9);
+    int turn = 1, winner;
+    do {
+        boardToInput(game, input);
+        net.forward(input);
+        game.toArray(cells.data());
+        uint16_t best = minimaxLookup(cells.data(), turn).bestMoves;
+        for (int i = 0; i < 9; ++i) target[i] = (best >> i) & 1;
+        emit(input, target, 1.0);
+
+        std::vector<double> probs = softmax(net.output, 0.5);
+        double total = 0;
+        for (int i = 0; i < 9; ++i) total += game.isEmpty(i) ? probs[i] : 0.0;
+        double r = std::uniform_real_distribution<>(0.0, total)(rng);
+        int move = -1;
+        for (int i = 0; i < 9; ++i) {
+            if (!game.isEmpty(i)) continue;
+            move = i;
+            if ((r -= probs[i]) <= 0) break;
+        }
+        game.play(move, turn);
+        turn = -turn;
+    } while (!game.isGameOver(winner));
+}
+
+#endif // TICTACTOE_BENCH_H
@@ -0,0 +1,14 @@
+// AIMode.h
+#ifndef AIMODE_H // include guard
+#define AIMODE_H
+
+// aiMode values of the TicTacToe entry points (tictactoe.h), also used by MNKGame.h
+enum AIMode {
+    EXPERT      = 0,
+    CREATIVE    = 1,
+    MINIMAX     = 2,
+    RANDOM      = 3,
+    TENSORFLOW  = 4  // ← Placeholder
+};
+
+#endif // AIMODE_H
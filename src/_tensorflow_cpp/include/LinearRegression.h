@@ -7,6 +7,7 @@
 #include <iostream>
 #include <vector>
 #include <numeric> // For std::accumulate
+#include <cmath>
 
 //
 class LinearRegression
@@ -108,3 +109,101 @@ class LinearRegression
             return predictedTotalTime;
  		}	
 };
+
+// Multivariate least squares: y ~ b0 + sum(bi * xi) [+ sum(bij * xi * xj) for i <= j]
+// Inputs are standardized before expansion and a small ridge (L2) penalty keeps the
+// normal equations well conditioned when samples are few or clustered.
+class MultipleLinearRegression
+{
+	public :
+	   int    inputs    = 0;
+	   bool   quadratic = true;
+	   double lambda    = 1e-3;               // ridge penalty (the bias term is not penalized)
+	   std::vector<double> coefficients = {}; // bias first, then linear, then quadratic terms
+	   std::vector<double> mean         = {};
+	   std::vector<double> scale        = {};
+
+	   //
+	   MultipleLinearRegression(int inputs, bool quadratic = true, double lambda = 1e-3)
+	   	: inputs(inputs), quadratic(quadratic), lambda(lambda)
+	   {
+	   		this->mean.assign(inputs, 0.0);
+	   		this->scale.assign(inputs, 1.0);
+	   }
+
+	   //
+	   int featureCount() const
+	   {
+	   		return 1 + inputs + (quadratic ? inputs * (inputs + 1) / 2 : 0);
+	   }
+
+	   // Writes featureCount() values for one input row
+	   void expand(const double* x, double* out) const
+	   {
+		    int k = 0;
+		    out[k++] = 1.0;
+		    for (int i = 0; i < inputs; ++i) out[k++] = (x[i] - mean[i]) / scale[i];
+		    if (!quadratic) return;
+		    for (int i = 0; i < inputs; ++i)
+		        for (int j = i; j < inputs; ++j) out[k++] = out[1 + i] * out[1 + j];
+	   }
+
+	   // Solves (F^T F + lambda I) b = F^T y. Returns false if there is no data or the system is singular.
+	   bool fit(const std::vector<std::vector<double>>& x, const std::vector<double>& y)
+	   {
+		    size_t n = x.size();
+		    if (n == 0 || y.size() != n) return false;
+
+		    for (int i = 0; i < inputs; ++i) {
+		        double sum = 0.0, sumSq = 0.0;
+		        for (const auto& row : x) { sum += row[i]; sumSq += row[i] * row[i]; }
+		        mean[i]  = sum / n;
+		        double variance = sumSq / n - mean[i] * mean[i];
+		        scale[i] = variance > 1e-12 ? std::sqrt(variance) : 1.0;
+		    }
+
+		    int m = featureCount();
+		    std::vector<double> a(m * (m + 1), 0.0); // augmented normal equations, row-major
+		    std::vector<double> f(m);
+		    for (size_t s = 0; s < n; ++s) {
+		        expand(x[s].data(), f.data());
+		        for (int r = 0; r < m; ++r) {
+		            for (int c = 0; c < m; ++c) a[r * (m + 1) + c] += f[r] * f[c];
+		            a[r * (m + 1) + m] += f[r] * y[s];
+		        }
+		    }
+		    for (int r = 1; r < m; ++r) a[r * (m + 1) + r] += lambda * n;
+
+		    // Gaussian elimination with partial pivoting
+		    for (int col = 0; col < m; ++col) {
+		        int pivot = col;
+		        for (int r = col + 1; r < m; ++r)
+		            if (std::fabs(a[r * (m + 1) + col]) > std::fabs(a[pivot * (m + 1) + col])) pivot = r;
+		        if (std::fabs(a[pivot * (m + 1) + col]) < 1e-12) return false;
+		        if (pivot != col)
+		            for (int c = 0; c <= m; ++c) std::swap(a[col * (m + 1) + c], a[pivot * (m + 1) + c]);
+		        for (int r = col + 1; r < m; ++r) {
+		            double factor = a[r * (m + 1) + col] / a[col * (m + 1) + col];
+		            for (int c = col; c <= m; ++c) a[r * (m + 1) + c] -= factor * a[col * (m + 1) + c];
+		        }
+		    }
+		    coefficients.assign(m, 0.0);
+		    for (int r = m - 1; r >= 0; --r) {
+		        double sum = a[r * (m + 1) + m];
+		        for (int c = r + 1; c < m; ++c) sum -= a[r * (m + 1) + c] * coefficients[c];
+		        coefficients[r] = sum / a[r * (m + 1) + r];
+		    }
+		    return true;
+	   }
+
+	   //
+	   double predict(const double* x) const
+	   {
+		    if (coefficients.empty()) return 0.0;
+		    std::vector<double> f(featureCount());
+		    expand(x, f.data());
+		    return std::inner_product(f.begin(), f.end(), coefficients.begin(), 0.0);
+	   }
+
+	   double predict(const std::vector<double>& x) const { return predict(x.data()); }
+};
@@ -0,0 +1,631 @@
+#ifndef MNK_GAME_H
+#define MNK_GAME_H
+
+// m,n,k games: k in a row on a width x height board (TicTacToe is 3,3,3; Gomoku is 15,15,5).
+//
+// Search is negamax alpha-beta with iterative deepening under a time budget. Moves are
+// ordered by the transposition-table move, two killers per ply, a history table and
+// distance from the centre. The transposition table is keyed by a Zobrist hash reduced to
+// the smallest of the board's symmetric images (8 on square boards, 4 otherwise), so
+// rotated and mirrored positions share one entry. Best moves are stored in that canonical
+// frame and mapped back on probe.
+//
+// Values are from the side to move: WIN_SCORE minus the ply of the winning move for a
+// forced win, 0 for a draw, and a k-window heuristic below WIN_THRESHOLD when the horizon
+// was reached. A result is 'solved' when its iteration never hit the horizon or proved a
+// win/loss no longer than the iteration depth.
+//
+// Player 1 is X and -1 is O, as in tictactoe.h. Either side may move first. Boards are
+// limited to MAX_CELLS cells.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#include "AIMode.h"
+#include "MappedFile.h"
+
+namespace MNK {
+
+constexpr int MAX_CELLS     = 1024;
+constexpr int WIN_SCORE     = 1000000;
+constexpr int WIN_THRESHOLD = WIN_SCORE - 10000;
+
+inline uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// One generator per thread, so games on different threads never share state
+inline std::mt19937& Rng() {
+    thread_local std::mt19937 rng(std::random_device{}());
+    return rng;
+}
+
+// ----------------------------
+// Board
+// ----------------------------
+
+class Board {
+public:
+    // Sizes outside 1..MAX_CELLS cells fall back to 3x3; k is at least 2
+    Board(int w = 3, int h = 3, int inRow = 3)
+        : width(Fits(w, h) ? w : 3), height(Fits(w, h) ? h : 3), k(std::max(2, inRow)), cells(width * height) {
+        grid.assign(cells, 0);
+        symmetries = (width == height) ? 8 : 4;
+
+        uint64_t seed = 0x6D6E6B2D67616D65ull ^ (static_cast<uint64_t>(width) << 40) ^ (height << 20) ^ k;
+        keys.resize(cells * 2);
+        for (auto& key : keys) key = SplitMix64(seed);
+        sideKey = SplitMix64(seed);
+
+        // perm[s][cell] = cell's image under symmetry s; inverse maps canonical cells back
+        perm.assign(symmetries, std::vector<int>(cells));
+        inverse.assign(symmetries, std::vector<int>(cells));
+        for (int s = 0; s < symmetries; ++s) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int tx = (s & 1) ? width - 1 - x : x;
+                    int ty = (s & 2) ? height - 1 - y : y;
+                    int image = (s & 4) ? tx * width + ty : ty * width + tx; // s >= 4 only on square boards
+                    perm[s][y * width + x] = image;
+                    inverse[s][image] = y * width + x;
+                }
+            }
+        }
+
+        // Every k-cell window in the four line directions, for the horizon heuristic
+        const int dirs[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+        for (const auto& d : dirs) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int ex = x + d[0] * (k - 1), ey = y + d[1] * (k - 1);
+                    if (ex < 0 || ex >= width || ey < 0 || ey >= height) continue;
+                    for (int i = 0; i < k; ++i) windows.push_back((y + d[1] * i) * width + x + d[0] * i);
+                }
+            }
+        }
+        windowCount = static_cast<int>(windows.size()) / k;
+        std::vector<std::vector<int>> byCell(cells);
+        for (int w = 0; w < windowCount; ++w)
+            for (int i = 0; i < k; ++i) byCell[windows[w * k + i]].push_back(w);
+        cellWindowStart.push_back(0);
+        for (const auto& list : byCell) {
+            cellWindows.insert(cellWindows.end(), list.begin(), list.end());
+            cellWindowStart.push_back(static_cast<int>(cellWindows.size()));
+        }
+        reset();
+    }
+
+    void reset() {
+        std::fill(grid.begin(), grid.end(), 0);
+        stones = 0;
+        std::fill(std::begin(hashes), std::end(hashes), 0);
+        stonesIn.assign(windowCount * 2, 0);
+        score = 0;
+        threats[0] = threats[1] = 0;
+    }
+
+    int at(int cell) const { return grid[cell]; }
+    bool isEmpty(int cell) const { return grid[cell] == 0; }
+    bool isFull() const { return stones == cells; }
+    int empties() const { return cells - stones; }
+
+    void play(int cell, int player) {
+        grid[cell] = static_cast<int8_t>(player);
+        stones++;
+        int side = player == 1 ? 0 : 1;
+        for (int s = 0; s < symmetries; ++s) hashes[s] ^= keys[perm[s][cell] * 2 + side];
+        updateWindows(cell, side, 1);
+    }
+
+    void undo(int cell) {
+        int side = grid[cell] == 1 ? 0 : 1;
+        for (int s = 0; s < symmetries; ++s) hashes[s] ^= keys[perm[s][cell] * 2 + side];
+        updateWindows(cell, side, -1);
+        grid[cell] = 0;
+        stones--;
+    }
+
+    // Windows where 'player' has k-1 stones and the opponent none: each is a win next move
+    int threatCount(int player) const { return threats[player == 1 ? 0 : 1]; }
+
+    // The empty cell of one such window, or -1
+    int threatCell(int player) const {
+        int side = player == 1 ? 0 : 1;
+        for (int w = 0; w < windowCount; ++w) {
+            if (stonesIn[w * 2 + side] != k - 1 || stonesIn[w * 2 + (1 - side)] != 0) continue;
+            for (int i = 0; i < k; ++i)
+                if (grid[windows[w * k + i]] == 0) return windows[w * k + i];
+        }
+        return -1;
+    }
+
+    // True if the stone on 'cell' completes k in a row
+    bool isWin(int cell) const { return completes(cell, grid[cell]); }
+
+    // True if 'player' on 'cell' would make k in a row (the cell itself is not read)
+    bool completes(int cell, int player) const {
+        const int dirs[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+        int x0 = cell % width, y0 = cell / width;
+        for (const auto& d : dirs) {
+            int run = 1;
+            for (int sign = -1; sign <= 1; sign += 2) {
+                int x = x0 + d[0] * sign, y = y0 + d[1] * sign;
+                while (x >= 0 && x < width && y >= 0 && y < height && grid[y * width + x] == player) {
+                    run++;
+                    x += d[0] * sign;
+                    y += d[1] * sign;
+                }
+            }
+            if (run >= k) return true;
+        }
+        return false;
+    }
+
+    // Winner by a full scan (0 if none); search only needs isWin on the last move
+    int winner() const {
+        for (int c = 0; c < cells; ++c)
+            if (grid[c] != 0 && isWin(c)) return grid[c];
+        return 0;
+    }
+
+    // Base-3 code as in tictactoe.h (0 empty, 1 X, 2 O; cell i weighs 3^i); exact up to 40 cells
+    uint64_t code() const {
+        uint64_t value = 0;
+        for (int c = cells - 1; c >= 0; --c) value = value * 3 + (grid[c] == 1 ? 1 : grid[c] == -1 ? 2 : 0);
+        return value;
+    }
+
+    // Smallest hash over the symmetric images; 'sym' receives the image that produced it
+    uint64_t canonicalKey(int player, int& sym) const {
+        sym = 0;
+        for (int s = 1; s < symmetries; ++s)
+            if (hashes[s] < hashes[sym]) sym = s;
+        return hashes[sym] ^ (player == 1 ? 0 : sideKey);
+    }
+
+    // Open k-windows weighted by stones (1, 4, 16, ...), player's minus the opponent's;
+    // kept up to date by play/undo. Clamped below WIN_THRESHOLD so that long windows
+    // (k >= 12) are never mistaken for a forced result.
+    int evaluate(int player) const {
+        int64_t v = std::clamp<int64_t>(score, -(WIN_THRESHOLD - 1), WIN_THRESHOLD - 1);
+        return static_cast<int>(player == 1 ? v : -v);
+    }
+
+    static bool Fits(int w, int h) { return w >= 1 && h >= 1 && w * h <= MAX_CELLS; }
+
+    int width, height, k, cells;
+    int symmetries;
+    std::vector<std::vector<int>> perm, inverse;
+
+private:
+    std::vector<int8_t> grid;
+    int stones = 0;
+    uint64_t hashes[8];
+    std::vector<uint64_t> keys;
+    uint64_t sideKey = 0;
+    std::vector<int> windows;   // k cells per window
+    int windowCount = 0;
+    std::vector<int> cellWindows, cellWindowStart;  // windows through each cell
+    std::vector<uint8_t> stonesIn;                  // X and O stones per window
+    int64_t score = 0;                              // evaluate(1) before clamping
+    int threats[2];
+
+    // Weight of a window for X: only windows holding a single colour count
+    int windowValue(int x, int o) const {
+        if (o == 0 && x > 0) return 1 << std::min(2 * (x - 1), 28);
+        if (x == 0 && o > 0) return -(1 << std::min(2 * (o - 1), 28));
+        return 0;
+    }
+
+    void updateWindows(int cell, int side, int delta) {
+        for (int i = cellWindowStart[cell]; i < cellWindowStart[cell + 1]; ++i) {
+            uint8_t* c = &stonesIn[cellWindows[i] * 2];
+            score -= windowValue(c[0], c[1]);
+            if (c[0] == k - 1 && c[1] == 0) threats[0]--;
+            if (c[1] == k - 1 && c[0] == 0) threats[1]--;
+            c[side] = static_cast<uint8_t>(c[side] + delta);
+            score += windowValue(c[0], c[1]);
+            if (c[0] == k - 1 && c[1] == 0) threats[0]++;
+            if (c[1] == k - 1 && c[0] == 0) threats[1]++;
+        }
+    }
+};
+
+// ----------------------------
+// Search
+// ----------------------------
+
+struct SearchLimits {
+    double seconds = 1.0;   // stop deepening once spent; an unfinished iteration is discarded
+    int maxDepth = 0;       // 0 = until solved
+};
+
+struct SearchResult {
+    int move = -1;
+    int value = 0;
+    int depth = 0;          // last completed iteration
+    bool solved = false;
+    uint64_t nodes = 0;
+    double seconds = 0.0;
+};
+
+class Search {
+public:
+    explicit Search(int ttBits = 20) : table(size_t(1) << ttBits), mask((size_t(1) << ttBits) - 1) {}
+
+    void clear() { std::fill(table.begin(), table.end(), Entry{}); }
+
+    SearchResult think(Board& board, int player, const SearchLimits& limits = {}) {
+        SearchResult result;
+        if (board.cells != tableCells) {
+            tableCells = board.cells;
+            clear();
+        }
+        start = std::chrono::steady_clock::now();
+        budget = limits.seconds;
+        nodes = 0;
+        aborted = false;
+        history.assign(board.cells, 0);
+        killers.assign((board.cells + 1) * 2, -1);
+
+        int maxDepth = board.empties();
+        if (limits.maxDepth > 0) maxDepth = std::min(maxDepth, limits.maxDepth);
+        for (int depth = 1; depth <= maxDepth; ++depth) {
+            horizon = false;
+            int move = -1;
+            int value = root(board, player, depth, move);
+            if (aborted && depth > 1) break;
+            result.move = move;
+            result.value = value;
+            result.depth = depth;
+            // A win/loss is final once the iteration is as deep as the line (shorter ones found first)
+            result.solved = !horizon || (std::abs(value) > WIN_THRESHOLD && WIN_SCORE - std::abs(value) <= depth);
+            if (result.solved || elapsed() > budget) break;
+        }
+        result.nodes = nodes;
+        result.seconds = elapsed();
+        return result;
+    }
+
+private:
+    enum : uint8_t { EMPTY = 0, EXACT, LOWER, UPPER };
+
+    struct Entry {
+        uint64_t key = 0;
+        int32_t value = 0;
+        int16_t move = -1;      // canonical frame
+        uint16_t depth = 0;
+        uint8_t flag = EMPTY;
+    };
+
+    double elapsed() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Mate scores are stored relative to the node, so an entry is valid at any ply
+    static int toTable(int v, int ply) { return v > WIN_THRESHOLD ? v + ply : v < -WIN_THRESHOLD ? v - ply : v; }
+    static int fromTable(int v, int ply) { return v > WIN_THRESHOLD ? v - ply : v < -WIN_THRESHOLD ? v + ply : v; }
+
+    int orderMoves(const Board& board, int ttMove, int ply, int* moves) {
+        int count = 0;
+        int scores[MAX_CELLS];
+        double cx = (board.width - 1) / 2.0, cy = (board.height - 1) / 2.0;
+        for (int c = 0; c < board.cells; ++c) {
+            if (!board.isEmpty(c)) continue;
+            int score = history[c] - static_cast<int>(std::abs(c % board.width - cx) + std::abs(c / board.width - cy));
+            if (c == ttMove) score = std::numeric_limits<int>::max();
+            else if (c == killers[ply * 2] || c == killers[ply * 2 + 1]) score = std::numeric_limits<int>::max() - 1;
+            int i = count++;
+            while (i > 0 && scores[i - 1] < score) {   // insertion sort, best first
+                scores[i] = scores[i - 1];
+                moves[i] = moves[i - 1];
+                i--;
+            }
+            scores[i] = score;
+            moves[i] = c;
+        }
+        return count;
+    }
+
+    int root(Board& board, int player, int depth, int& bestMove) {
+        int moves[MAX_CELLS];
+        int count = orderMoves(board, lastRootMove, 0, moves);
+        int alpha = -WIN_SCORE - 1, beta = WIN_SCORE + 1;
+        int best = -WIN_SCORE - 1;
+        bestMove = -1;
+        for (int i = 0; i < count; ++i) {
+            int score = child(board, moves[i], player, depth, alpha, beta, 0);
+            if (aborted && depth > 1) return best;
+            if (score > best) {
+                best = score;
+                bestMove = moves[i];
+            }
+            alpha = std::max(alpha, score);
+        }
+        lastRootMove = bestMove;
+        return best;
+    }
+
+    int child(Board& board, int move, int player, int depth, int alpha, int beta, int ply) {
+        board.play(move, player);
+        int score;
+        if (board.isWin(move)) score = WIN_SCORE - (ply + 1);
+        else score = -negamax(board, -player, depth - 1, -beta, -alpha, ply + 1);
+        board.undo(move);
+        return score;
+    }
+
+    int negamax(Board& board, int player, int depth, int alpha, int beta, int ply) {
+        if ((++nodes & 1023) == 0 && elapsed() > budget) aborted = true;
+        if (aborted) return 0;
+        int empties = board.empties();
+        if (empties == 0) return 0;
+
+        int effective = std::min(depth, empties);  // depth >= empties searches to the end: exact
+        int sym;
+        uint64_t key = board.canonicalKey(player, sym);
+        Entry& entry = table[key & mask];
+        int ttMove = -1;
+        if (entry.flag != EMPTY && entry.key == key) {
+            if (entry.move >= 0) ttMove = board.inverse[sym][entry.move];
+            if (entry.depth >= effective) {
+                int v = fromTable(entry.value, ply);
+                if (entry.flag == EXACT || (entry.flag == LOWER && v >= beta) || (entry.flag == UPPER && v <= alpha)) {
+                    if (entry.depth < empties) horizon = true;
+                    return v;
+                }
+            }
+        }
+
+        // Forced moves: win now, or block the opponent's win (if there are two, any block loses)
+        if (board.threatCount(player) > 0) return WIN_SCORE - (ply + 1);
+
+        if (depth == 0) {
+            horizon = true;
+            return board.evaluate(player);
+        }
+
+        int moves[MAX_CELLS];
+        int count = 0;
+        if (board.threatCount(-player) > 0) moves[count++] = board.threatCell(-player);
+        else count = orderMoves(board, ttMove, ply, moves);
+        int alphaOrig = alpha;
+        int best = -WIN_SCORE - 1, bestMove = -1;
+        for (int i = 0; i < count; ++i) {
+            int score = child(board, moves[i], player, depth, alpha, beta, ply);
+            if (aborted) return 0;
+            if (score > best) {
+                best = score;
+                bestMove = moves[i];
+            }
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) {
+                if (killers[ply * 2] != moves[i]) {
+                    killers[ply * 2 + 1] = killers[ply * 2];
+                    killers[ply * 2] = moves[i];
+                }
+                if ((history[moves[i]] += depth * depth) > (1 << 24))
+                    for (int& h : history) h /= 2;
+                break;
+            }
+        }
+
+        entry.key = key;
+        entry.value = toTable(best, ply);
+        entry.move = static_cast<int16_t>(bestMove >= 0 ? board.perm[sym][bestMove] : -1);
+        entry.depth = static_cast<uint16_t>(effective);
+        entry.flag = best <= alphaOrig ? UPPER : best >= beta ? LOWER : EXACT;
+        return best;
+    }
+
+    std::vector<Entry> table;
+    size_t mask;
+    int tableCells = 0;
+    std::vector<int> history;
+    std::vector<int> killers;   // two per ply
+    int lastRootMove = -1;
+
+    std::chrono::steady_clock::time_point start;
+    double budget = 1.0;
+    uint64_t nodes = 0;
+    bool aborted = false;
+    bool horizon = false;
+};
+
+// ----------------------------
+// Endgame Tables
+// ----------------------------
+
+// Every state of a small board solved offline (see _tictactoe/MNKRetrograde.cpp), 2 bits per
+// state indexed by code() * 2 + (player == 1 ? 0 : 1): 32 states per little-endian 64-bit word.
+// Values are for the side to move; unreachable states stay TABLE_UNKNOWN.
+//
+// [EndgameHeader][uint64_t words...]
+constexpr char     TABLE_MAGIC[4]  = {'M', 'N', 'K', 'T'};
+constexpr uint32_t TABLE_VERSION   = 1;
+constexpr int      TABLE_MAX_CELLS = 20;   // 2 * 3^20 states = 1.7 GB
+
+enum : uint8_t { TABLE_UNKNOWN = 0, TABLE_WIN = 1, TABLE_LOSS = 2, TABLE_DRAW = 3 };
+
+#pragma pack(push, 1)
+struct EndgameHeader {
+    char     magic[4];
+    uint32_t version;
+    int32_t  width;
+    int32_t  height;
+    int32_t  k;
+    uint32_t reserved;
+    uint64_t states;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(EndgameHeader) == 32, "EndgameHeader must stay 32 bytes");
+
+inline uint64_t EndgameStates(int cells) {
+    uint64_t states = 2;
+    for (int i = 0; i < cells; ++i) states *= 3;
+    return states;
+}
+
+inline uint64_t EndgameWords(uint64_t states) { return (states + 31) / 32; }
+
+inline int EndgameValue(const uint64_t* words, uint64_t index) {
+    return static_cast<int>((words[index >> 5] >> ((index & 31) * 2)) & 3);
+}
+
+// Maps the file on the first probe; pages are then read on demand
+class EndgameTable {
+public:
+    explicit EndgameTable(std::string path) : path(std::move(path)) {}
+
+    // True if the file exists and was built for this board
+    bool Covers(const Board& board) {
+        std::call_once(mapped, [this] { Map(); });
+        return words && header.width == board.width && header.height == board.height && header.k == board.k;
+    }
+
+    int Probe(const Board& board, int player) {
+        if (!Covers(board)) return TABLE_UNKNOWN;
+        return EndgameValue(words, board.code() * 2 + (player == 1 ? 0 : 1));
+    }
+
+    // A move keeping the best value (winning, else drawing), or -1 if the table can't tell
+    int BestMove(const Board& board, int player) {
+        if (!Covers(board) || Probe(board, player) == TABLE_UNKNOWN) return -1;
+        uint64_t code = board.code(), pow3 = 1;
+        int best = -1, bestRank = -1;
+        const int rank[4] = {-1, 0, 2, 1};  // child value (opponent's view) -> preference
+        for (int c = 0; c < board.cells; ++c, pow3 *= 3) {
+            if (!board.isEmpty(c)) continue;
+            uint64_t child = code + (player == 1 ? 1 : 2) * pow3;
+            int r = rank[EndgameValue(words, child * 2 + (player == 1 ? 1 : 0))];
+            if (r > bestRank) {
+                bestRank = r;
+                best = c;
+            }
+        }
+        return best;
+    }
+
+    const EndgameHeader& Header() const { return header; }
+
+private:
+    void Map() {
+        if (!file.Open(path.c_str(), true) || file.Size() < sizeof(EndgameHeader)) return;
+        std::memcpy(&header, file.Data(), sizeof(header));
+        if (std::memcmp(header.magic, TABLE_MAGIC, 4) != 0 || header.version != TABLE_VERSION ||
+            header.width * header.height > TABLE_MAX_CELLS ||
+            header.states != EndgameStates(header.width * header.height) ||
+            file.Size() != sizeof(EndgameHeader) + EndgameWords(header.states) * sizeof(uint64_t)) {
+            file.Close();
+            return;
+        }
+        words = reinterpret_cast<const uint64_t*>(file.Data() + sizeof(EndgameHeader));
+    }
+
+    std::string path;
+    std::once_flag mapped;
+    MappedFile file;
+    EndgameHeader header{};
+    const uint64_t* words = nullptr;
+};
+
+// ----------------------------
+// Move Selection
+// ----------------------------
+
+// One-ply scores per cell (occupied cells 0): an immediate win is 1, otherwise the window
+// heuristic after the move scaled into [-0.9, 0.9]. Plays the role of the network output in tictactoe.h.
+inline std::vector<double> moveScores(Board& board, int player) {
+    std::vector<double> scores(board.cells, 0.0);
+    double scale = 1.0;
+    for (int c = 0; c < board.cells; ++c) {
+        if (!board.isEmpty(c)) continue;
+        board.play(c, player);
+        scores[c] = board.isWin(c) ? std::numeric_limits<double>::infinity() : board.evaluate(player);
+        board.undo(c);
+        if (std::isfinite(scores[c])) scale = std::max(scale, std::abs(scores[c]));
+    }
+    for (double& s : scores) s = std::isfinite(s) ? 0.9 * s / scale : 1.0;
+    return scores;
+}
+
+// Returns -1 for TENSORFLOW (no m,n,k model) or a full board. MINIMAX answers from 'table'
+// when it covers the board.
+inline int selectMove(Board& board, int player, int aiMode, double temperature, Search& search,
+                      const SearchLimits& limits = {}, EndgameTable* table = nullptr) {
+    std::vector<int> valid;
+    for (int c = 0; c < board.cells; ++c)
+        if (board.isEmpty(c)) valid.push_back(c);
+    if (valid.empty() || aiMode == TENSORFLOW) return -1;
+
+    if (aiMode == MINIMAX) {
+        int move = table ? table->BestMove(board, player) : -1;
+        return move >= 0 ? move : search.think(board, player, limits).move;
+    }
+    if (aiMode == RANDOM) {
+        std::uniform_int_distribution<> dist(0, static_cast<int>(valid.size()) - 1);
+        return valid[dist(Rng())];
+    }
+
+    auto scores = moveScores(board, player);
+    if (aiMode == CREATIVE) {
+        std::vector<double> weights;
+        for (int c : valid) weights.push_back(std::exp((scores[c] - 1.0) / temperature));
+        std::discrete_distribution<> dist(weights.begin(), weights.end());
+        return valid[dist(Rng())];
+    }
+    return *std::max_element(valid.begin(), valid.end(), [&](int a, int b) { return scores[a] < scores[b]; });
+}
+
+// ----------------------------
+// Self-play
+// ----------------------------
+
+struct GameRecord {
+    std::vector<int> moves;
+    int firstPlayer = 1;
+    int winner = 0;
+};
+
+// Both sides use aiMode; the opening side is random, as in RunTicTacToeSelfPlay
+inline bool RunSelfPlay(int width, int height, int k, int aiMode, double temperature,
+                        const SearchLimits& limits, GameRecord& record, EndgameTable* table = nullptr) {
+    if (aiMode == TENSORFLOW) {
+        std::cerr << "No TensorFlow model for " << width << "," << height << "," << k << " boards.\n";
+        return false;
+    }
+    Board board(width, height, k);
+    Search search(aiMode == MINIMAX ? 20 : 0);  // the other modes never search
+    std::uniform_int_distribution<> starter(0, 1);
+    int turn = starter(Rng()) == 0 ? 1 : -1;
+
+    record = GameRecord{};
+    record.firstPlayer = turn;
+    while (!board.isFull()) {
+        int move = selectMove(board, turn, aiMode, temperature, search, limits, table);
+        board.play(move, turn);
+        record.moves.push_back(move);
+        if (board.isWin(move)) {
+            record.winner = turn;
+            break;
+        }
+        turn = -turn;
+    }
+    return true;
+}
+
+} // namespace MNK
+
+#endif // MNK_GAME_H
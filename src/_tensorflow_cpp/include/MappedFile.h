@@ -0,0 +1,98 @@
+// MappedFile.h
+#ifndef MAPPEDFILE_H // include guard
+#define MAPPEDFILE_H
+#endif
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+//
+// Read-only memory mapping of a whole file (used by dataset readers and lookup tables)
+//
+class MappedFile
+{
+    public :
+        //
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile() { Close(); }
+
+        // randomAccess: lookup tables probed out of order (no read-ahead)
+        bool Open(const char* path, bool randomAccess = false)
+        {
+            Close();
+#ifdef _WIN32
+            fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                     OPEN_EXISTING, randomAccess ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE) return false;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) { Close(); return false; }
+            size = static_cast<size_t>(fileSize.QuadPart);
+
+            mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mappingHandle) { Close(); return false; }
+
+            data = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            if (!data) { Close(); return false; }
+#else
+            fd = ::open(path, O_RDONLY);
+            if (fd < 0) return false;
+
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size == 0) { Close(); return false; }
+            size = static_cast<size_t>(st.st_size);
+
+            void* p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) { Close(); return false; }
+            data = static_cast<const uint8_t*>(p);
+            madvise(p, size, randomAccess ? MADV_RANDOM : MADV_SEQUENTIAL);
+#endif
+            return true;
+        }
+
+        //
+        void Close()
+        {
+#ifdef _WIN32
+            if (data) UnmapViewOfFile(data);
+            if (mappingHandle) CloseHandle(mappingHandle);
+            if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+            mappingHandle = nullptr;
+            fileHandle    = INVALID_HANDLE_VALUE;
+#else
+            if (data) munmap(const_cast<uint8_t*>(data), size);
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+#endif
+            data = nullptr;
+            size = 0;
+        }
+
+        //
+        const uint8_t* Data() const { return data; }
+        size_t         Size() const { return size; }
+        bool           IsOpen() const { return data != nullptr; }
+
+    private :
+        //
+        const uint8_t* data = nullptr;
+        size_t         size = 0;
+#ifdef _WIN32
+        HANDLE fileHandle    = INVALID_HANDLE_VALUE;
+        HANDLE mappingHandle = nullptr;
+#else
+        int    fd = -1;
+#endif
+};
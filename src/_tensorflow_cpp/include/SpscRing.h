@@ -0,0 +1,67 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+// Bounded lock-free single-producer / single-consumer ring buffer.
+// Exactly one thread may call TryPush and exactly one (other) thread may call TryPop.
+// Each side caches the opposite index so the shared atomics are only re-read when the
+// ring looks full (producer) or empty (consumer).
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    bool TryPush(const T& value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cachedTail == Capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail == Capacity) return false;
+        }
+        buffer[h & (Capacity - 1)] = value;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Blocks the producer (yielding) until there is room
+    void Push(const T& value) {
+        while (!TryPush(value)) std::this_thread::yield();
+    }
+
+    bool TryPop(T& out) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == cachedHead) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t == cachedHead) return false;
+        }
+        out = buffer[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called concurrently with the other side
+    size_t Size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+    static constexpr size_t CapacityValue() { return Capacity; }
+
+private:
+    // Producer and consumer state live on separate cache lines
+    alignas(64) std::atomic<size_t> head{0};
+    size_t cachedTail = 0;
+    alignas(64) std::atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+    alignas(64) T buffer[Capacity];
+};
+
+#endif // SPSC_RING_H
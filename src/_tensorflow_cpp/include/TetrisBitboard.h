@@ -0,0 +1,194 @@
+#ifndef TETRIS_BITBOARD_H
+#define TETRIS_BITBOARD_H
+
+// Occupancy-only Tetris board: one uint16_t per row (bit c = column c), 40 bytes in total.
+// Placement validity, line clears and the heuristic features are a few mask operations
+// per row instead of per-cell loops. FindBestMove here scores exactly like the
+// BoardEngine version and picks the same move (same enumeration order and tie-breaks).
+
+#include "TetrisEngine.h"
+#include <cstring>
+
+namespace TetrisEngine {
+
+constexpr uint16_t FULL_ROW = (1u << BOARD_WIDTH) - 1;
+
+// Row masks of one rotation relative to the 4x4 box, plus its occupied extent
+struct PieceMask {
+    uint16_t rows[4] = {};
+    int minRow = 4, maxRow = -1, minCol = 4, maxCol = -1;
+};
+
+inline const std::array<std::array<PieceMask, 4>, 7>& PieceMasks() {
+    static const auto masks = [] {
+        std::array<std::array<PieceMask, 4>, 7> m{};
+        for (int p = 0; p < 7; ++p) {
+            for (int rot = 0; rot < 4; ++rot) {
+                PieceMask& pm = m[p][rot];
+                for (int r = 0; r < 4; ++r) {
+                    for (int c = 0; c < 4; ++c) {
+                        if (!TETROMINO_SHAPES[p][rot][r][c]) continue;
+                        pm.rows[r] |= static_cast<uint16_t>(1u << c);
+                        pm.minRow = std::min(pm.minRow, r); pm.maxRow = std::max(pm.maxRow, r);
+                        pm.minCol = std::min(pm.minCol, c); pm.maxCol = std::max(pm.maxCol, c);
+                    }
+                }
+            }
+        }
+        return m;
+    }();
+    return masks;
+}
+
+inline int PopCount16(uint32_t v) {
+#if defined(__GNUC__)
+    return __builtin_popcount(v);
+#else
+    int n = 0;
+    for (; v; v &= v - 1) ++n;
+    return n;
+#endif
+}
+
+inline int LowestBit(uint32_t v) {
+#if defined(__GNUC__)
+    return __builtin_ctz(v);
+#else
+    int n = 0;
+    while (!(v & 1u)) { v >>= 1; ++n; }
+    return n;
+#endif
+}
+
+class Bitboard {
+public:
+    uint16_t rows[BOARD_HEIGHT] = {};
+
+    void Reset() { std::memset(rows, 0, sizeof(rows)); }
+
+    static Bitboard FromBoard(const BoardEngine& board) {
+        Bitboard b;
+        const auto& grid = board.GetGrid();
+        for (int r = 0; r < BOARD_HEIGHT; ++r)
+            for (int c = 0; c < BOARD_WIDTH; ++c)
+                if (grid[r][c]) b.rows[r] |= static_cast<uint16_t>(1u << c);
+        return b;
+    }
+
+    // Reads the BoardEngine::PackBits layout (bit r * BOARD_WIDTH + c, LSB first)
+    static Bitboard FromBits(const uint8_t* in) {
+        Bitboard b;
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            for (int c = 0; c < BOARD_WIDTH; ++c) {
+                int bit = r * BOARD_WIDTH + c;
+                if ((in[bit >> 3] >> (bit & 7)) & 1) b.rows[r] |= static_cast<uint16_t>(1u << c);
+            }
+        }
+        return b;
+    }
+
+    // Mask of shape row i shifted to column x (caller guarantees the columns are in range)
+    static uint16_t Shifted(uint16_t mask, int x) {
+        return static_cast<uint16_t>(x >= 0 ? mask << x : mask >> -x);
+    }
+
+    // Same rules as BoardEngine::IsValid: every cell inside the board and on an empty cell
+    bool IsValid(int pieceId, int rotation, int x, int y) const {
+        const PieceMask& pm = PieceMasks()[pieceId - 1][rotation];
+        if (x + pm.minCol < 0 || x + pm.maxCol >= BOARD_WIDTH) return false;
+        if (y + pm.minRow < 0 || y + pm.maxRow >= BOARD_HEIGHT) return false;
+        for (int r = pm.minRow; r <= pm.maxRow; ++r)
+            if (rows[y + r] & Shifted(pm.rows[r], x)) return false;
+        return true;
+    }
+
+    // Landing row with BoardEngine's FindBestMove semantics: a piece that doesn't fit at
+    // y = 0 moves up until it does (y < 0, top rows of its box empty), then falls.
+    // INVALID_Y when it fits nowhere.
+    static constexpr int INVALID_Y = -1000;
+    int DropY(int pieceId, int rotation, int x) const {
+        int y = 0;
+        while (!IsValid(pieceId, rotation, x, y)) {
+            if (--y <= -BOARD_HEIGHT) return INVALID_Y;
+        }
+        while (IsValid(pieceId, rotation, x, y + 1)) ++y;
+        return y;
+    }
+
+    void Place(int pieceId, int rotation, int x, int y) {
+        const PieceMask& pm = PieceMasks()[pieceId - 1][rotation];
+        for (int r = pm.minRow; r <= pm.maxRow; ++r) {
+            int py = y + r;
+            if (py >= 0 && py < BOARD_HEIGHT) rows[py] |= Shifted(pm.rows[r], x) & FULL_ROW;
+        }
+    }
+
+    // Removes full rows; bit r of *clearedRows (optional) is set for each removed row index
+    int ClearLines(uint32_t* clearedRows = nullptr) {
+        int write = BOARD_HEIGHT - 1, cleared = 0;
+        uint32_t mask = 0;
+        for (int read = BOARD_HEIGHT - 1; read >= 0; --read) {
+            if (rows[read] == FULL_ROW) { ++cleared; mask |= 1u << read; continue; }
+            rows[write--] = rows[read];
+        }
+        while (write >= 0) rows[write--] = 0;
+        if (clearedRows) *clearedRows = mask;
+        return cleared;
+    }
+
+    // Aggregate height, holes and bumpiness exactly as the BoardEngine getters compute them
+    void Features(int& height, int& holes, int& bumpiness, int* columnHeights = nullptr) const {
+        int heights[BOARD_WIDTH] = {};
+        uint32_t seen = 0;
+        holes = 0;
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            uint32_t fresh = rows[r] & ~seen;
+            while (fresh) {
+                int c = LowestBit(fresh);
+                heights[c] = BOARD_HEIGHT - r;
+                fresh &= fresh - 1;
+            }
+            seen |= rows[r];
+            holes += PopCount16(seen & ~static_cast<uint32_t>(rows[r]));
+        }
+        height = 0;
+        bumpiness = 0;
+        for (int c = 0; c < BOARD_WIDTH; ++c) {
+            height += heights[c];
+            if (c + 1 < BOARD_WIDTH) bumpiness += std::abs(heights[c] - heights[c + 1]);
+        }
+        if (columnHeights) std::copy(heights, heights + BOARD_WIDTH, columnHeights);
+    }
+
+    bool IsGameOver(int pieceId) const { return !IsValid(pieceId, 0, 3, 0); }
+};
+
+inline Move FindBestMove(const Bitboard& board, int pieceId, const HeuristicWeights& weights, int* evaluated = nullptr) {
+    Move best = {0, 0, std::numeric_limits<double>::lowest()};
+    int count = 0;
+    for (int r = 0; r < 4; ++r) {
+        for (int x = -3; x < BOARD_WIDTH + 3; ++x) {
+            int y = board.DropY(pieceId, r, x);
+            if (y == Bitboard::INVALID_Y) continue;
+
+            Bitboard next = board;
+            next.Place(pieceId, r, x, y);
+            int lines = next.ClearLines();
+            int height, holes, bump;
+            next.Features(height, holes, bump);
+
+            double score = lines * lines * weights.w_lines +
+                           height * weights.w_height +
+                           holes * weights.w_holes +
+                           bump * weights.w_bumpiness;
+            count++;
+            if (score > best.score) best = {r, x, score};
+        }
+    }
+    if (evaluated) *evaluated = count;
+    return best;
+}
+
+} // namespace TetrisEngine
+
+#endif // TETRIS_BITBOARD_H
@@ -0,0 +1,317 @@
+#ifndef TETRIS_DATASET_H
+#define TETRIS_DATASET_H
+
+#include "TetrisEngine.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TetrisEngine {
+namespace Dataset {
+
+// --- File Format ---
+// [FileHeader][DatasetRecord * recordCount], little-endian, no padding.
+constexpr char     FILE_MAGIC[4]   = {'T', 'T', 'D', 'S'};
+constexpr uint32_t FILE_VERSION    = 1;
+constexpr size_t   CHUNK_RECORDS   = 8192;  // records per thread buffer (256 KB)
+constexpr size_t   MAX_QUEUED_CHUNKS = 64;  // writer backlog before producers wait
+
+#pragma pack(push, 1)
+struct FileHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t reserved;
+    uint64_t recordCount;  // patched on Close(); 0 means "derive from file size"
+    uint64_t seed;
+};
+
+struct DatasetRecord {
+    uint8_t  cells[BOARD_PACKED_BYTES]; // board before the move, see BoardEngine::PackBits
+    uint8_t  piece;                     // 1..7
+    uint8_t  nextPiece;                 // 1..7 (preview)
+    uint8_t  rotation;                  // chosen placement
+    int8_t   x;
+    int8_t   y;
+    uint16_t eventualLines;             // lines cleared from this move to the end of the game, saturated at 65535
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FileHeader) == 32, "FileHeader must stay 32 bytes");
+static_assert(sizeof(DatasetRecord) == 32, "DatasetRecord must stay 32 bytes");
+
+// --- Streaming Writer ---
+// Producers hand over full chunks; a single background thread does all fwrite calls.
+class DatasetWriter {
+public:
+    DatasetWriter() = default;
+    DatasetWriter(const DatasetWriter&) = delete;
+    DatasetWriter& operator=(const DatasetWriter&) = delete;
+    ~DatasetWriter() { Close(); }
+
+    bool Open(const char* path, uint64_t seed) {
+        file = std::fopen(path, "wb");
+        if (!file) return false;
+        std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+
+        FileHeader header{};
+        std::memcpy(header.magic, FILE_MAGIC, 4);
+        header.version = FILE_VERSION;
+        header.recordSize = sizeof(DatasetRecord);
+        header.seed = seed;
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+            std::fclose(file);
+            file = nullptr;
+            return false;
+        }
+
+        stopping = false;
+        written = 0;
+        writerThread = std::thread(&DatasetWriter::WriterLoop, this);
+        return true;
+    }
+
+    // Returns an empty buffer with CHUNK_RECORDS capacity, recycled when possible
+    std::vector<DatasetRecord> AcquireBuffer() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!freeBuffers.empty()) {
+            std::vector<DatasetRecord> buf = std::move(freeBuffers.back());
+            freeBuffers.pop_back();
+            return buf;
+        }
+        std::vector<DatasetRecord> buf;
+        buf.reserve(CHUNK_RECORDS);
+        return buf;
+    }
+
+    void Submit(std::vector<DatasetRecord>&& chunk) {
+        if (chunk.empty()) return;
+        std::unique_lock<std::mutex> lock(mutex);
+        spaceAvailable.wait(lock, [&] { return pending.size() < MAX_QUEUED_CHUNKS; });
+        pending.push_back(std::move(chunk));
+        dataAvailable.notify_one();
+    }
+
+    // Drains the queue, patches the record count and closes the file
+    bool Close() {
+        if (!file) return true;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        dataAvailable.notify_one();
+        if (writerThread.joinable()) writerThread.join();
+
+        bool ok = !failed;
+        uint64_t count = written;
+        if (std::fseek(file, offsetof(FileHeader, recordCount), SEEK_SET) == 0) {
+            ok = ok && std::fwrite(&count, sizeof(count), 1, file) == 1;
+        } else {
+            ok = false;
+        }
+        ok = (std::fclose(file) == 0) && ok;
+        file = nullptr;
+        return ok;
+    }
+
+    uint64_t RecordsWritten() const { return written; }
+
+private:
+    void WriterLoop() {
+        for (;;) {
+            std::vector<DatasetRecord> chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                dataAvailable.wait(lock, [&] { return stopping || !pending.empty(); });
+                if (pending.empty()) return; // stopping and drained
+                chunk = std::move(pending.front());
+                pending.pop_front();
+            }
+            spaceAvailable.notify_one();
+
+            // After a failed write the rest is drained but not written or counted
+            size_t n = failed ? 0 : std::fwrite(chunk.data(), sizeof(DatasetRecord), chunk.size(), file);
+            if (n != chunk.size()) failed = true;
+            written += n;
+
+            chunk.clear();
+            std::lock_guard<std::mutex> lock(mutex);
+            freeBuffers.push_back(std::move(chunk));
+        }
+    }
+
+    std::FILE* file = nullptr;
+    std::thread writerThread;
+    std::mutex mutex;
+    std::condition_variable dataAvailable;
+    std::condition_variable spaceAvailable;
+    std::deque<std::vector<DatasetRecord>> pending;
+    std::vector<std::vector<DatasetRecord>> freeBuffers;
+    bool stopping = false;
+    std::atomic<bool> failed{false};
+    std::atomic<uint64_t> written{0};
+};
+
+// --- Memory-Mapped Reader ---
+class DatasetReader {
+public:
+    bool Open(const char* path) {
+        if (!file.Open(path)) return false;
+        if (file.Size() < sizeof(FileHeader)) { file.Close(); return false; }
+
+        std::memcpy(&header, file.Data(), sizeof(header));
+        if (std::memcmp(header.magic, FILE_MAGIC, 4) != 0 ||
+            header.version != FILE_VERSION ||
+            header.recordSize != sizeof(DatasetRecord)) {
+            file.Close();
+            return false;
+        }
+
+        // A writer that died before Close() leaves recordCount at 0
+        uint64_t available = (file.Size() - sizeof(FileHeader)) / sizeof(DatasetRecord);
+        count = (header.recordCount != 0 && header.recordCount <= available) ? header.recordCount : available;
+        records = reinterpret_cast<const DatasetRecord*>(file.Data() + sizeof(FileHeader));
+        return true;
+    }
+
+    size_t Size() const { return static_cast<size_t>(count); }
+    uint64_t Seed() const { return header.seed; }
+    const DatasetRecord& operator[](size_t i) const { return records[i]; }
+    const DatasetRecord* begin() const { return records; }
+    const DatasetRecord* end() const { return records + count; }
+
+    static void UnpackBoard(const DatasetRecord& rec, BoardEngine& board) {
+        board.LoadFromBits(rec.cells);
+    }
+
+private:
+    MappedFile file;
+    FileHeader header{};
+    const DatasetRecord* records = nullptr;
+    uint64_t count = 0;
+};
+
+// --- Generator ---
+// With more than one thread the records are reproducible as a set but not in file order:
+// workers submit chunks as they fill, so games interleave and one game can span two chunks.
+// Use threads = 1 when the file itself must be byte-identical across runs.
+struct GeneratorConfig {
+    HeuristicWeights weights;
+    int games = 1000;
+    int maxMovesPerGame = 500;
+    int threads = 0;        // 0 = std::thread::hardware_concurrency()
+    bool useSearch = false; // FindBestMoveLookahead instead of FindBestMove
+    uint64_t seed = 1;      // game i uses seed + i, so runs are reproducible
+};
+
+struct GeneratorStats {
+    uint64_t games = 0;
+    uint64_t records = 0;
+    uint64_t lines = 0;
+    double seconds = 0.0;
+};
+
+// Plays one game with its own RNG and appends its records; returns total lines cleared
+inline int PlayRecordedGame(const GeneratorConfig& cfg, uint64_t gameSeed, std::vector<DatasetRecord>& out) {
+    std::mt19937 rng(static_cast<uint32_t>(gameSeed ^ (gameSeed >> 32)));
+    std::uniform_int_distribution<int> pieceDist(1, 7);
+
+    BoardEngine board;
+    size_t first = out.size();
+    int lines = 0;
+    int nextPiece = pieceDist(rng);
+
+    for (int moves = 0; moves < cfg.maxMovesPerGame; ++moves) {
+        int currentPiece = nextPiece;
+        nextPiece = pieceDist(rng);
+        if (board.IsGameOver({currentPiece, 0, 3, 0})) break;
+
+        Move m = cfg.useSearch ? FindBestMoveLookahead(board, currentPiece, nextPiece, cfg.weights)
+                               : FindBestMove(board, currentPiece, cfg.weights);
+
+        Piece p{currentPiece, m.rotation, m.x, 0};
+        while (!board.IsValid(p)) p.y--;
+        while (board.IsValid({currentPiece, m.rotation, m.x, p.y + 1})) p.y++;
+
+        DatasetRecord rec;
+        board.PackBits(rec.cells);
+        rec.piece = static_cast<uint8_t>(currentPiece);
+        rec.nextPiece = static_cast<uint8_t>(nextPiece);
+        rec.rotation = static_cast<uint8_t>(m.rotation);
+        rec.x = static_cast<int8_t>(m.x);
+        rec.y = static_cast<int8_t>(p.y);
+
+        board.PlacePiece(p);
+        int cleared = board.ClearLines();
+        rec.eventualLines = static_cast<uint16_t>(cleared); // this move only, summed below
+        out.push_back(rec);
+        lines += cleared;
+    }
+
+    uint32_t fromHere = 0;
+    for (size_t i = out.size(); i-- > first;) {
+        fromHere = std::min<uint32_t>(fromHere + out[i].eventualLines, UINT16_MAX);
+        out[i].eventualLines = static_cast<uint16_t>(fromHere);
+    }
+    return lines;
+}
+
+inline bool GenerateDataset(const char* path, const GeneratorConfig& cfg, GeneratorStats* stats = nullptr) {
+    DatasetWriter writer;
+    if (!writer.Open(path, cfg.seed)) return false;
+
+    int threads = cfg.threads > 0 ? cfg.threads : static_cast<int>(std::thread::hardware_concurrency());
+    if (threads <= 0) threads = 1;
+
+    std::atomic<int> nextGame{0};
+    std::atomic<uint64_t> totalLines{0};
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&]() {
+        std::vector<DatasetRecord> chunk = writer.AcquireBuffer();
+        std::vector<DatasetRecord> game;
+        game.reserve(cfg.maxMovesPerGame);
+        uint64_t lines = 0;
+
+        for (int g = nextGame++; g < cfg.games; g = nextGame++) {
+            game.clear();
+            lines += PlayRecordedGame(cfg, cfg.seed + static_cast<uint64_t>(g), game);
+
+            for (const auto& rec : game) {
+                chunk.push_back(rec);
+                if (chunk.size() == CHUNK_RECORDS) {
+                    writer.Submit(std::move(chunk));
+                    chunk = writer.AcquireBuffer();
+                }
+            }
+        }
+        writer.Submit(std::move(chunk));
+        totalLines += lines;
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) pool.emplace_back(worker);
+    for (auto& t : pool) t.join();
+
+    bool ok = writer.Close();
+    if (stats) {
+        stats->games = static_cast<uint64_t>(cfg.games);
+        stats->records = writer.RecordsWritten();
+        stats->lines = totalLines;
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return ok;
+}
+
+} // namespace Dataset
+} // namespace TetrisEngine
+
+#endif // TETRIS_DATASET_H
@@ -2,18 +2,36 @@
 #define TETRIS_ENGINE_H
 
 #include <array>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
 #include <random>
 #include <limits>
 #include <algorithm>
 #include <string>
 #include <fstream>
 #include <iomanip>
+#include <memory>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include "TetrisProfiler.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define TETRIS_HAS_AVX2_KERNEL 1
+#endif
 
 namespace TetrisEngine {
 
 // --- Constants ---
 constexpr int BOARD_WIDTH = 10;
 constexpr int BOARD_HEIGHT = 20;
+constexpr int BOARD_PACKED_BYTES = (BOARD_WIDTH * BOARD_HEIGHT + 7) / 8; // 1 bit per cell
+constexpr int MAX_CANDIDATES = 4 * (BOARD_WIDTH + 6); // rotations x columns tried by FindBestMove
+// Learned-evaluator input: column heights, lines cleared, aggregate height, holes, bumpiness
+constexpr int FEATURE_COUNT = BOARD_WIDTH + 4;
 
 // --- Type Definitions ---
 using Shape = std::array<std::array<int, 4>, 4>;
@@ -137,6 +155,27 @@ public:
         }
     }
 
+    // Packs occupancy (not colors) into 200 bits, row-major, LSB first
+    void PackBits(uint8_t* out) const {
+        for (int i = 0; i < BOARD_PACKED_BYTES; ++i) out[i] = 0;
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            for (int c = 0; c < BOARD_WIDTH; ++c) {
+                int bit = r * BOARD_WIDTH + c;
+                if (grid[r][c] != 0) out[bit >> 3] |= static_cast<uint8_t>(1u << (bit & 7));
+            }
+        }
+    }
+
+    // Inverse of PackBits; occupied cells get 'fill' since colors are not stored
+    void LoadFromBits(const uint8_t* in, int fill = 8) {
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            for (int c = 0; c < BOARD_WIDTH; ++c) {
+                int bit = r * BOARD_WIDTH + c;
+                grid[r][c] = ((in[bit >> 3] >> (bit & 7)) & 1) ? fill : 0;
+            }
+        }
+    }
+
     bool IsValid(const Piece& piece) const {
         const auto& shape = piece.GetShape();
         for (int r = 0; r < 4; ++r) {
@@ -251,34 +290,202 @@ public:
 };
 
 // --- AI Evaluation ---
-inline Move FindBestMove(const BoardEngine& board, int pieceId, const HeuristicWeights& weights) {
+// 'evaluated' (optional) receives the number of placements scored
+inline Move FindBestMove(const BoardEngine& board, int pieceId, const HeuristicWeights& weights, int* evaluated = nullptr) {
+    TETRIS_PROBE(FIND_BEST_MOVE);
     Move best = {0, 0, std::numeric_limits<double>::lowest()};
+    int count = 0;
     for (int r = 0; r < 4; ++r) {
         for (int x = -3; x < BOARD_WIDTH + 3; ++x) {
             int y = 0;
             Piece testPiece{pieceId, r, x, y};
+            {
+                TETRIS_PROBE(DROP);
+                while (!board.IsValid(testPiece) && testPiece.y > -BOARD_HEIGHT) {
+                    testPiece.y--;
+                }
+                if (testPiece.y <= -BOARD_HEIGHT) continue;
+                
+                while (board.IsValid({pieceId, r, x, testPiece.y + 1})) {
+                    testPiece.y++;
+                }
+            }
+
+            if (!board.IsValid(testPiece)) continue;
+
+            BoardEngine next = board;
+            int lines, height, holes, bump;
+            {
+                TETRIS_PROBE(PLACE);
+                next.PlacePiece(testPiece);
+            }
+            {
+                TETRIS_PROBE(CLEAR);
+                lines = next.ClearLines();
+            }
+            {
+                TETRIS_PROBE(FEATURES);
+                height = next.GetAggregateHeight();
+                holes = next.GetHoles();
+                bump = next.GetBumpiness();
+            }
+
+            double score = lines * lines * weights.w_lines +
+                          height * weights.w_height +
+                          holes * weights.w_holes +
+                          bump * weights.w_bumpiness;
+
+            count++;
+            if (score > best.score) {
+                best = {r, x, score};
+            }
+        }
+    }
+    if (evaluated) *evaluated = count;
+    return best;
+}
+
+// --- Batched Evaluation ---
+// A candidate is one reachable placement plus the features of the board it leaves behind.
+// Evaluators expose: void ScoreBatch(const Candidate* candidates, int count, double* scores)
+struct Candidate {
+    int rotation = 0;
+    int x = 0;
+    int y = 0;
+    float features[FEATURE_COUNT] = {};
+};
+
+enum FeatureIndex {
+    F_LINES = BOARD_WIDTH,
+    F_HEIGHT,
+    F_HOLES,
+    F_BUMPINESS
+};
+
+inline void ExtractFeatures(const BoardEngine& board, int lines, float* out) {
+    const auto& grid = board.GetGrid();
+    int aggregate = 0, holes = 0, bump = 0, prev = 0;
+    for (int c = 0; c < BOARD_WIDTH; ++c) {
+        int height = 0;
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            if (grid[r][c] != 0) {
+                if (height == 0) height = BOARD_HEIGHT - r;
+            } else if (height != 0) {
+                holes++;
+            }
+        }
+        out[c] = static_cast<float>(height);
+        aggregate += height;
+        if (c > 0) bump += std::abs(height - prev);
+        prev = height;
+    }
+    out[F_LINES] = static_cast<float>(lines);
+    out[F_HEIGHT] = static_cast<float>(aggregate);
+    out[F_HOLES] = static_cast<float>(holes);
+    out[F_BUMPINESS] = static_cast<float>(bump);
+}
+
+// Fills 'out' (MAX_CANDIDATES entries) in the same order FindBestMove visits placements
+inline int EnumerateCandidates(const BoardEngine& board, int pieceId, Candidate* out) {
+    int count = 0;
+    for (int r = 0; r < 4; ++r) {
+        for (int x = -3; x < BOARD_WIDTH + 3; ++x) {
+            Piece testPiece{pieceId, r, x, 0};
+            {
+                TETRIS_PROBE(DROP);
+                while (!board.IsValid(testPiece) && testPiece.y > -BOARD_HEIGHT) {
+                    testPiece.y--;
+                }
+                if (testPiece.y <= -BOARD_HEIGHT) continue;
+
+                while (board.IsValid({pieceId, r, x, testPiece.y + 1})) {
+                    testPiece.y++;
+                }
+            }
+
+            BoardEngine next = board;
+            int lines;
+            {
+                TETRIS_PROBE(PLACE);
+                next.PlacePiece(testPiece);
+            }
+            {
+                TETRIS_PROBE(CLEAR);
+                lines = next.ClearLines();
+            }
+
+            Candidate& cand = out[count++];
+            cand.rotation = r;
+            cand.x = x;
+            cand.y = testPiece.y;
+            TETRIS_PROBE(FEATURES);
+            ExtractFeatures(next, lines, cand.features);
+        }
+    }
+    return count;
+}
+
+// The linear heuristic as a batch evaluator; scores match FindBestMove exactly
+struct LinearEvaluator {
+    HeuristicWeights weights;
+
+    void ScoreBatch(const Candidate* candidates, int count, double* scores) const {
+        for (int i = 0; i < count; ++i) {
+            const float* f = candidates[i].features;
+            int lines = static_cast<int>(f[F_LINES]);
+            scores[i] = lines * lines * weights.w_lines +
+                        static_cast<int>(f[F_HEIGHT]) * weights.w_height +
+                        static_cast<int>(f[F_HOLES]) * weights.w_holes +
+                        static_cast<int>(f[F_BUMPINESS]) * weights.w_bumpiness;
+        }
+    }
+};
+
+// Scores every placement of the piece with one evaluator call
+template <typename Evaluator>
+Move FindBestMoveBatched(const BoardEngine& board, int pieceId, Evaluator& evaluator) {
+    TETRIS_PROBE(FIND_BEST_MOVE);
+    Candidate candidates[MAX_CANDIDATES];
+    double scores[MAX_CANDIDATES];
+    int count = EnumerateCandidates(board, pieceId, candidates);
+
+    Move best = {0, 0, std::numeric_limits<double>::lowest()};
+    if (count == 0) return best;
+
+    evaluator.ScoreBatch(candidates, count, scores);
+    for (int i = 0; i < count; ++i) {
+        if (scores[i] > best.score) {
+            best = {candidates[i].rotation, candidates[i].x, scores[i]};
+        }
+    }
+    return best;
+}
+
+// Two-piece search: scores each placement by the best follow-up of the preview piece
+inline Move FindBestMoveLookahead(const BoardEngine& board, int pieceId, int nextPieceId, const HeuristicWeights& weights) {
+    Move best = {0, 0, std::numeric_limits<double>::lowest()};
+    for (int r = 0; r < 4; ++r) {
+        for (int x = -3; x < BOARD_WIDTH + 3; ++x) {
+            Piece testPiece{pieceId, r, x, 0};
             while (!board.IsValid(testPiece) && testPiece.y > -BOARD_HEIGHT) {
                 testPiece.y--;
             }
             if (testPiece.y <= -BOARD_HEIGHT) continue;
-            
+
             while (board.IsValid({pieceId, r, x, testPiece.y + 1})) {
                 testPiece.y++;
             }
 
-            if (!board.IsValid(testPiece)) continue;
-
             BoardEngine next = board;
             next.PlacePiece(testPiece);
             int lines = next.ClearLines();
-            int height = next.GetAggregateHeight();
-            int holes = next.GetHoles();
-            int bump = next.GetBumpiness();
 
-            double score = lines * lines * weights.w_lines +
-                          height * weights.w_height +
-                          holes * weights.w_holes +
-                          bump * weights.w_bumpiness;
+            double score = lines * lines * weights.w_lines;
+            if (next.IsGameOver({nextPieceId, 0, 3, 0})) {
+                score = std::numeric_limits<double>::lowest() / 2;
+            } else {
+                score += FindBestMove(next, nextPieceId, weights).score;
+            }
 
             if (score > best.score) {
                 best = {r, x, score};
@@ -288,6 +495,141 @@ inline Move FindBestMove(const BoardEngine& board, int pieceId, const HeuristicW
     return best;
 }
 
+// --- Small MLP Evaluator (FEATURE_COUNT -> 32 -> 1, ReLU) ---
+// Dependency-free learned evaluator. Text file format:
+//   MLP <inputs> <hidden>
+//   <hidden rows of <inputs> weights> <hidden biases> <hidden output weights> <output bias>
+class MLPEvaluator {
+public:
+    static constexpr int HIDDEN = 32;
+    static constexpr int INPUT_STRIDE = 16; // FEATURE_COUNT padded for aligned loads
+
+    MLPEvaluator() = default;
+
+    bool Load(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file) return false;
+        std::string tag;
+        int inputs = 0, hidden = 0;
+        file >> tag >> inputs >> hidden;
+        if (tag != "MLP" || inputs != FEATURE_COUNT || hidden != HIDDEN) return false;
+
+        MLPEvaluator loaded;
+        for (int j = 0; j < HIDDEN; ++j)
+            for (int k = 0; k < FEATURE_COUNT; ++k) file >> loaded.w1[k][j];
+        for (int j = 0; j < HIDDEN; ++j) file >> loaded.b1[j];
+        for (int j = 0; j < HIDDEN; ++j) file >> loaded.w2[j];
+        file >> loaded.b2;
+        if (file.fail()) return false;
+
+        *this = loaded;
+        return true;
+    }
+
+    bool Save(const std::string& filename) const {
+        std::ofstream file(filename);
+        if (!file) return false;
+        file << "MLP " << FEATURE_COUNT << " " << HIDDEN << "\n" << std::setprecision(9);
+        for (int j = 0; j < HIDDEN; ++j) {
+            for (int k = 0; k < FEATURE_COUNT; ++k) file << w1[k][j] << " ";
+            file << "\n";
+        }
+        for (int j = 0; j < HIDDEN; ++j) file << b1[j] << " ";
+        file << "\n";
+        for (int j = 0; j < HIDDEN; ++j) file << w2[j] << " ";
+        file << "\n" << b2 << "\n";
+        return file.good();
+    }
+
+    // He-style random init, for benchmarking and as a training starting point
+    static MLPEvaluator Random(uint32_t seed) {
+        MLPEvaluator m;
+        std::mt19937 rng(seed);
+        std::normal_distribution<float> d1(0.0f, std::sqrt(2.0f / FEATURE_COUNT));
+        std::normal_distribution<float> d2(0.0f, std::sqrt(2.0f / HIDDEN));
+        for (int k = 0; k < FEATURE_COUNT; ++k)
+            for (int j = 0; j < HIDDEN; ++j) m.w1[k][j] = d1(rng);
+        for (int j = 0; j < HIDDEN; ++j) m.w2[j] = d2(rng);
+        return m;
+    }
+
+    void ScoreBatch(const Candidate* candidates, int count, double* scores) const {
+#ifdef TETRIS_HAS_AVX2_KERNEL
+        if (useSimd && HasAvx2()) {
+            ScoreBatchAvx2(candidates, count, scores);
+            return;
+        }
+#endif
+        ScoreBatchScalar(candidates, count, scores);
+    }
+
+    void ScoreBatchScalar(const Candidate* candidates, int count, double* scores) const {
+        for (int i = 0; i < count; ++i) {
+            const float* f = candidates[i].features;
+            float h[HIDDEN];
+            std::copy(b1, b1 + HIDDEN, h);
+            for (int k = 0; k < FEATURE_COUNT; ++k)
+                for (int j = 0; j < HIDDEN; ++j) h[j] += w1[k][j] * f[k];
+            float out = 0.0f;
+            for (int j = 0; j < HIDDEN; ++j) out += w2[j] * std::max(h[j], 0.0f);
+            scores[i] = out + b2;
+        }
+    }
+
+    static bool HasAvx2() {
+#ifdef TETRIS_HAS_AVX2_KERNEL
+        static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    bool useSimd = true; // lets benchmarks compare against the scalar path
+
+private:
+#ifdef TETRIS_HAS_AVX2_KERNEL
+    // Hidden layer is 4 x 8 lanes; each feature broadcasts into one FMA per lane group
+    __attribute__((target("avx2,fma")))
+    void ScoreBatchAvx2(const Candidate* candidates, int count, double* scores) const {
+        const __m256 zero = _mm256_setzero_ps();
+        for (int i = 0; i < count; ++i) {
+            const float* f = candidates[i].features;
+            __m256 h0 = _mm256_load_ps(b1 + 0);
+            __m256 h1 = _mm256_load_ps(b1 + 8);
+            __m256 h2 = _mm256_load_ps(b1 + 16);
+            __m256 h3 = _mm256_load_ps(b1 + 24);
+            for (int k = 0; k < FEATURE_COUNT; ++k) {
+                __m256 x = _mm256_set1_ps(f[k]);
+                h0 = _mm256_fmadd_ps(_mm256_load_ps(w1[k] + 0), x, h0);
+                h1 = _mm256_fmadd_ps(_mm256_load_ps(w1[k] + 8), x, h1);
+                h2 = _mm256_fmadd_ps(_mm256_load_ps(w1[k] + 16), x, h2);
+                h3 = _mm256_fmadd_ps(_mm256_load_ps(w1[k] + 24), x, h3);
+            }
+            __m256 acc = _mm256_mul_ps(_mm256_max_ps(h0, zero), _mm256_load_ps(w2 + 0));
+            acc = _mm256_fmadd_ps(_mm256_max_ps(h1, zero), _mm256_load_ps(w2 + 8), acc);
+            acc = _mm256_fmadd_ps(_mm256_max_ps(h2, zero), _mm256_load_ps(w2 + 16), acc);
+            acc = _mm256_fmadd_ps(_mm256_max_ps(h3, zero), _mm256_load_ps(w2 + 24), acc);
+
+            __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+            s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+            s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+            scores[i] = _mm_cvtss_f32(s) + b2;
+        }
+    }
+#endif
+
+    alignas(32) float w1[INPUT_STRIDE][HIDDEN] = {}; // stored input-major (transposed)
+    alignas(32) float b1[HIDDEN] = {};
+    alignas(32) float w2[HIDDEN] = {};
+    float b2 = 0.0f;
+};
+
+enum class EvaluatorType {
+    Linear = 0,
+    MLP    = 1
+};
+
 // --- File I/O ---
 inline bool SaveWeights(const char* filename, double* weights) {
     std::ofstream file(filename);
@@ -304,44 +646,219 @@ inline bool LoadWeights(const char* filename, double* weights) {
     return !file.fail();
 }
 
-// --- DLL EXPORT INTERFACE ---
+// --- Replay Encoding ---
+// One uint16 per placement: piece (3 bits) | rotation (2) | x + 3 (4) | y + 4 (5).
+// The landing row is stored so decoding never has to search for it.
+constexpr int REPLAY_X_BIAS = 3;
+constexpr int REPLAY_Y_BIAS = 4;
+
+struct ReplayMove {
+    int piece, rotation, x, y;
+};
+
+inline uint16_t EncodeReplayMove(int piece, int rotation, int x, int y) {
+    return static_cast<uint16_t>((piece & 7) | ((rotation & 3) << 3) |
+                                 (((x + REPLAY_X_BIAS) & 15) << 5) | (((y + REPLAY_Y_BIAS) & 31) << 9));
+}
+
+inline ReplayMove DecodeReplayMove(uint16_t m) {
+    return {m & 7, (m >> 3) & 3, ((m >> 5) & 15) - REPLAY_X_BIAS, ((m >> 9) & 31) - REPLAY_Y_BIAS};
+}
+
+// Piece 1..7 with its 4x4 box overlapping the board; anything else is a corrupt record
+// (a piece field of 0 would index TETROMINO_SHAPES[-1])
+inline bool IsValidReplayMove(const ReplayMove& m) {
+    return m.piece >= 1 && m.piece <= 7 &&
+           m.x >= -REPLAY_X_BIAS && m.x < BOARD_WIDTH + REPLAY_X_BIAS &&
+           m.y >= -REPLAY_Y_BIAS && m.y < BOARD_HEIGHT;
+}
+
+// Seed plus placements of one game; see TetrisReplay.h for the file format and decoder
+struct ReplayLog {
+    uint32_t seed = 0;
+    bool gameOver = false;
+    std::vector<uint16_t> moves;
+};
+
+// --- Zero-copy State Export ---
+// Each instance publishes its board into a StateExport that pollers read in place.
+// 'version' is a seqlock: odd while the owner writes, +2 per published change, never reset.
+// rowVersion[r] is the version that last changed row r, so a poller that remembers the
+// version it copied fetches only newer rows (ReadStateExport). Rows are padded to 16 bytes
+// and all payload words go through atomic_ref, so concurrent reads are not data races.
+constexpr int EXPORT_ROW_STRIDE = 16;
+
+struct ExportStats {
+    int32_t score, lines, level, moves, next, gameOver; // TetrisGameStats layout
+};
+
+struct alignas(8) StateExport {
+    uint64_t version = 0;
+    uint64_t dirtyRows = 0;                              // rows changed by the latest version
+    uint64_t rowVersion[BOARD_HEIGHT] = {};
+    ExportStats stats = {};
+    uint8_t cells[BOARD_HEIGHT][EXPORT_ROW_STRIDE] = {}; // piece id per cell, columns >= BOARD_WIDTH stay 0
+};
+
+static_assert(sizeof(ExportStats) % 8 == 0 && sizeof(StateExport) % 8 == 0, "export payload must be whole words");
+
+inline uint64_t LoadWord(const uint64_t& w, std::memory_order order = std::memory_order_relaxed) {
+    return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(w)).load(order);
+}
+
+inline void StoreWord(uint64_t& w, uint64_t value, std::memory_order order = std::memory_order_relaxed) {
+    std::atomic_ref<uint64_t>(w).store(value, order);
+}
+
+inline void LoadWords(void* dst, const void* shared, size_t bytes) {
+    const auto* src = static_cast<const uint64_t*>(shared);
+    for (size_t i = 0; i < bytes / 8; ++i) {
+        uint64_t w = LoadWord(src[i]);
+        std::memcpy(static_cast<uint8_t*>(dst) + i * 8, &w, 8);
+    }
+}
+
+inline void StoreWords(void* shared, const void* src, size_t bytes) {
+    auto* dst = static_cast<uint64_t*>(shared);
+    for (size_t i = 0; i < bytes / 8; ++i) {
+        uint64_t w;
+        std::memcpy(&w, static_cast<const uint8_t*>(src) + i * 8, 8);
+        StoreWord(dst[i], w);
+    }
+}
+
+// Copies rows changed after 'sinceVersion' into board (row-major BOARD_HEIGHT x BOARD_WIDTH,
+// may be null) and the stats, and returns the version read. Returns sinceVersion and copies
+// nothing when there is no newer version. *copiedRows receives the mask of rows written.
+inline uint64_t ReadStateExport(const StateExport& e, uint64_t sinceVersion, uint8_t* board,
+                                ExportStats* stats, uint32_t* copiedRows = nullptr) {
+    alignas(8) uint8_t rows[BOARD_HEIGHT][EXPORT_ROW_STRIDE];
+    ExportStats s;
+    for (;;) {
+        uint64_t v1 = LoadWord(e.version, std::memory_order_acquire);
+        if (v1 & 1) { std::this_thread::yield(); continue; }
+        if (v1 == sinceVersion) {
+            if (copiedRows) *copiedRows = 0;
+            return v1;
+        }
+
+        uint32_t mask = 0;
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            if (LoadWord(e.rowVersion[r]) <= sinceVersion) continue;
+            mask |= 1u << r;
+            if (board) LoadWords(rows[r], e.cells[r], EXPORT_ROW_STRIDE);
+        }
+        LoadWords(&s, &e.stats, sizeof(s));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (LoadWord(e.version) != v1) continue; // torn: the owner published meanwhile
+
+        if (board) {
+            for (int r = 0; r < BOARD_HEIGHT; ++r)
+                if (mask & (1u << r)) std::memcpy(board + r * BOARD_WIDTH, rows[r], BOARD_WIDTH);
+        }
+        if (stats) *stats = s;
+        if (copiedRows) *copiedRows = mask;
+        return v1;
+    }
+}
+
+// --- DLL EXPORT INTERFACE (C ABI in TetrisEngineAPI.h / _tetris/TetrisEngine.cpp) ---
 class  TetrisGameInstance {
 public:
     BoardEngine board;
     HeuristicWeights weights;
+    EvaluatorType evaluator = EvaluatorType::Linear;
+    std::shared_ptr<const MLPEvaluator> mlp; // shared, read-only across instances
     int score = 0, lines = 0, level = 1;
     int currentPiece = 0, nextPiece = 0;
     bool gameOver = false;
+    std::mt19937 rng;   // per-instance piece sequence, reproducible from replay.seed
+    ReplayLog replay;
+    StateExport exported; // written only by the thread that steps this instance
     
     TetrisGameInstance() {
         Reset();
     }
+
+    // Never touches Random::Generator(), so worker threads can construct instances
+    explicit TetrisGameInstance(uint32_t seed) {
+        Reset(seed);
+    }
     
     void Reset() {
+        Reset(static_cast<uint32_t>(Random::Generator()()));
+    }
+    
+    void Reset(uint32_t seed) {
         board.Reset();
         score = lines = level = 0;
         gameOver = false;
-        nextPiece = Random::Int(1, 7);
+        rng.seed(seed);
+        replay.seed = seed;
+        replay.gameOver = false;
+        replay.moves.clear();
+        nextPiece = NextRandomPiece();
+        PublishState(true);
+    }
+
+    // Publishes board and stats to 'exported' as one new version; StepAI and Reset call it,
+    // code that edits 'board' directly must call it too
+    void PublishState(bool allRows = false) {
+        alignas(8) uint8_t row[EXPORT_ROW_STRIDE] = {};
+        uint64_t version = LoadWord(exported.version) + 2;
+        uint64_t dirty = 0;
+
+        StoreWord(exported.version, version - 1);
+        std::atomic_thread_fence(std::memory_order_release);
+        const auto& grid = board.GetGrid();
+        for (int r = 0; r < BOARD_HEIGHT; ++r) {
+            for (int c = 0; c < BOARD_WIDTH; ++c) row[c] = static_cast<uint8_t>(grid[r][c]);
+            if (!allRows && std::memcmp(row, publishedRows[r], EXPORT_ROW_STRIDE) == 0) continue;
+            std::memcpy(publishedRows[r], row, EXPORT_ROW_STRIDE);
+            StoreWords(exported.cells[r], row, EXPORT_ROW_STRIDE);
+            StoreWord(exported.rowVersion[r], version);
+            dirty |= 1ull << r;
+        }
+        ExportStats stats{score, lines, level, static_cast<int32_t>(replay.moves.size()), nextPiece, gameOver ? 1 : 0};
+        StoreWords(&exported.stats, &stats, sizeof(stats));
+        StoreWord(exported.dirtyRows, dirty);
+        StoreWord(exported.version, version, std::memory_order_release);
     }
     
     bool LoadModel(const std::string& filename) {
         return LoadWeights(filename.c_str(), &weights.w_lines);
     }
     
+    bool LoadMLP(const std::string& filename) {
+        auto loaded = std::make_shared<MLPEvaluator>();
+        if (!loaded->Load(filename)) return false;
+        mlp = std::move(loaded);
+        return true;
+    }
+    
+    // Falls back to Linear when MLP is requested but no network is attached
+    void SetEvaluator(EvaluatorType type) {
+        evaluator = (type == EvaluatorType::MLP && !mlp) ? EvaluatorType::Linear : type;
+    }
+    
     void StepAI() {
         if (gameOver) return;
         
         currentPiece = nextPiece;
-        nextPiece = Random::Int(1, 7);
+        nextPiece = NextRandomPiece();
         
         if (board.IsGameOver({currentPiece, 0, 3, 0})) {
             gameOver = true;
+            replay.gameOver = true;
+            PublishState();
             return;
         }
         
         // Find best move
         int rotation = 0, x = 0;
-        Move best = FindBestMove(board, currentPiece, weights);
+        Move best = (evaluator == EvaluatorType::MLP && mlp)
+            ? FindBestMoveBatched(board, currentPiece, *mlp)
+            : FindBestMove(board, currentPiece, weights);
         rotation = best.rotation;
         x = best.x;
         
@@ -351,6 +868,7 @@ public:
         while (board.IsValid({currentPiece, rotation, x, y + 1})) y++;
         
         board.PlacePiece({currentPiece, rotation, x, y});
+        replay.moves.push_back(EncodeReplayMove(currentPiece, rotation, x, y));
         int cleared = board.ClearLines();
         
         if (cleared) {
@@ -358,6 +876,7 @@ public:
             score += cleared * cleared * 100 * level;
             level = 1 + (lines / 10);
         }
+        PublishState();
     }
     
     void GetState(int* boardState, int* outScore, int* outLines, int* outLevel, int* outNext) {
@@ -381,6 +900,14 @@ public:
         // Check if this board state is game over for a new piece
         return evalBoard.IsGameOver({1, 0, 3, 0});
     }
+
+private:
+    uint8_t publishedRows[BOARD_HEIGHT][EXPORT_ROW_STRIDE] = {}; // owner's copy of exported.cells
+
+    int NextRandomPiece() {
+        std::uniform_int_distribution<int> dist(1, 7);
+        return dist(rng);
+    }
 };
     
 }; // namespace TetrisEngine
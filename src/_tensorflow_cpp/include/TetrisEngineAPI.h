@@ -0,0 +1,74 @@
+#ifndef TETRIS_ENGINE_API_H
+#define TETRIS_ENGINE_API_H
+
+// C ABI of TetrisEngine.dll (implemented in _tetris/TetrisEngine.cpp).
+//
+// Every entry point works on whole batches so a managed host pays the interop cost once
+// per batch instead of once per step or per board. Boards are row-major
+// BOARD_HEIGHT x BOARD_WIDTH (20 x 10) cells, 0 = empty, 1..7 = piece id.
+
+#include <cstdint>
+
+#ifdef _WIN32
+    #define TETRIS_API extern "C" __declspec(dllexport) __stdcall
+#else
+    #define TETRIS_API extern "C" __attribute__((visibility("default")))
+#endif
+
+typedef void* TETRIS_Instance;
+
+#pragma pack(push, 4)
+struct TetrisGameStats {
+    int32_t score;
+    int32_t lines;
+    int32_t level;
+    int32_t moves;
+    int32_t next;       // upcoming piece id
+    int32_t gameOver;   // 1 once no new piece can spawn
+};
+#pragma pack(pop)
+
+// Published state of one instance (TetrisEngine::StateExport). 'version' is odd while the
+// instance is writing and grows by 2 per change; rowVersion[r] is the version that last
+// changed row r. Rows are 16 bytes apart, columns 10..15 are padding.
+struct TetrisStateExport {
+    uint64_t version;
+    uint64_t dirtyRows;         // bit r set when the latest version changed row r
+    uint64_t rowVersion[20];
+    TetrisGameStats stats;
+    uint8_t cells[20][16];
+};
+
+// --- Instances ---
+TETRIS_API TETRIS_Instance CreateGame(uint32_t seed);
+TETRIS_API void DestroyGame(TETRIS_Instance game);
+TETRIS_API void ResetGame(TETRIS_Instance game, uint32_t seed);
+TETRIS_API void SetGameWeights(TETRIS_Instance game, const double* weights);  // lines, height, holes, bumpiness
+TETRIS_API int  LoadGameModel(TETRIS_Instance game, const char* filename);
+TETRIS_API int  StepAI(TETRIS_Instance game);                                // 1 if a piece was placed
+TETRIS_API int  StepAIMany(TETRIS_Instance game, int steps);                 // placements made (stops at game over)
+TETRIS_API void GetGameState(TETRIS_Instance game, int* board, TetrisGameStats* stats);
+
+// --- Polling ---
+// Stable pointer to the instance's published state, valid until DestroyGame.
+TETRIS_API const TetrisStateExport* GetGameExport(TETRIS_Instance game);
+// Copies the rows changed since *version into board (20 x 10 bytes, kept by the caller
+// between polls) plus the stats, and advances *version. Start with *version = 0.
+// Returns 0 without copying anything when the frame is unchanged.
+TETRIS_API int PollGameState(TETRIS_Instance game, uint64_t* version, uint8_t* board, TetrisGameStats* stats);
+// PollGameState over n instances: boards holds n x 200 bytes, versions and stats n entries.
+// Returns the number of instances that changed.
+TETRIS_API int PollGames(const TETRIS_Instance* games, int n, uint64_t* versions, uint8_t* boards,
+                         TetrisGameStats* stats);
+
+// --- Batches ---
+// Plays count independent games (one per seed, up to maxMoves placements each, 0 = 500)
+// across all cores; out_stats receives one entry per game.
+TETRIS_API void RunGames(const double* weights, const uint32_t* seeds, int count, int maxMoves,
+                         TetrisGameStats* out_stats);
+
+// out[i] = 1 when board i cannot spawn a new piece (LoadFromArray + IsGameOver fused).
+// Returns the number of game-over boards.
+TETRIS_API int EvaluateBoards(const int8_t* boards, int n, uint8_t* out);
+
+#endif // TETRIS_ENGINE_API_H
@@ -0,0 +1,260 @@
+#ifndef TETRIS_PIPELINE_H
+#define TETRIS_PIPELINE_H
+
+// Simulation / presentation pipeline for the visual Tetris demos.
+//
+// The simulation thread (SimulateGame) publishes compact GameEvents into an SPSC ring,
+// staying at most SIMULATION_LEAD_EVENTS ahead and sleeping otherwise; the render thread
+// replays them on its own copy of the board, synthesizes the drop animation and paces
+// frames to the configured rate. When presentation falls behind schedule (slow terminal)
+// animation frames are dropped; spawn, lock and game over frames are always shown. The
+// engine only supplies a small adapter and its shape table, so the same pipeline serves
+// TetrisEngine.h and TetrisEngineStateless.h.
+
+#include "SpscRing.h"
+#include "TetrisRenderer.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace TetrisConsole {
+
+using ShapeTable = std::array<std::array<std::array<std::array<int, 4>, 4>, 4>, 7>;
+
+enum class EventType : uint8_t {
+    Spawn,    // piece appears at the top: piece, next, stats
+    Lock,     // piece dropped from startY to finalY and locked; stats are after line clears
+    GameOver
+};
+
+struct GameEvent {
+    EventType type = EventType::Spawn;
+    int8_t piece = 0;
+    int8_t rotation = 0;
+    int8_t x = 0;
+    int8_t startY = 0;
+    int8_t finalY = 0;
+    int8_t next = 0;
+    int32_t score = 0;
+    int32_t lines = 0;
+    int32_t level = 1;
+};
+
+constexpr size_t EVENT_RING_CAPACITY = 1024;
+using EventRing = SpscRing<GameEvent, EVENT_RING_CAPACITY>;
+
+// Events the simulation may run ahead of the renderer. Each piece is held on screen for
+// at least spawnHoldMs, so this keeps playback fed while the simulation mostly sleeps.
+constexpr size_t SIMULATION_LEAD_EVENTS = 64;
+constexpr int SIMULATION_WAIT_MS = 10;
+
+// Plays one AI game and publishes its events; call from the simulation thread. Engine is a
+// small adapter over the board:
+//   int  RandomPiece();
+//   bool IsGameOver(int piece);
+//   void BestMove(int piece, int& rotation, int& x);
+//   bool IsValid(int piece, int rotation, int x, int y);
+//   int  Lock(int piece, int rotation, int x, int y);  // places, clears, returns lines
+template <typename Engine>
+void SimulateGame(Engine& engine, EventRing& ring) {
+    auto publish = [&ring](const GameEvent& e) {
+        while (ring.Size() >= SIMULATION_LEAD_EVENTS || !ring.TryPush(e))
+            std::this_thread::sleep_for(std::chrono::milliseconds(SIMULATION_WAIT_MS));
+    };
+
+    GameEvent e;
+    int score = 0, lines = 0, level = 1;
+    int nextPieceId = engine.RandomPiece();
+
+    for (;;) {
+        int currentPieceId = nextPieceId;
+        nextPieceId = engine.RandomPiece();
+        if (engine.IsGameOver(currentPieceId)) break;
+
+        e = {};
+        e.type = EventType::Spawn;
+        e.piece = static_cast<int8_t>(currentPieceId);
+        e.next = static_cast<int8_t>(nextPieceId);
+        e.score = score; e.lines = lines; e.level = level;
+        publish(e);
+
+        int rotation = 0, x = 0;
+        engine.BestMove(currentPieceId, rotation, x);
+        int y = 0;
+        while (!engine.IsValid(currentPieceId, rotation, x, y)) y--;
+        int finalY = y;
+        while (engine.IsValid(currentPieceId, rotation, x, finalY + 1)) finalY++;
+
+        int cleared = engine.Lock(currentPieceId, rotation, x, finalY);
+        if (cleared) {
+            lines += cleared;
+            score += cleared * cleared * 100 * level;
+            level = 1 + (lines / 10);
+        }
+
+        e.type = EventType::Lock;
+        e.rotation = static_cast<int8_t>(rotation);
+        e.x = static_cast<int8_t>(x);
+        e.startY = static_cast<int8_t>(y);
+        e.finalY = static_cast<int8_t>(finalY);
+        e.score = score; e.lines = lines; e.level = level;
+        publish(e);
+    }
+
+    e = {};
+    e.type = EventType::GameOver;
+    e.score = score; e.lines = lines; e.level = level;
+    publish(e);
+}
+
+struct PlaybackConfig {
+    int targetFps = 60;    // upper bound on presented frames per second
+    int spawnHoldMs = 500;
+    int dropStepMs = 30;
+    int lockHoldMs = 200;
+    int maxLagMs = 1000;   // beyond this the schedule is reset instead of dropping forever
+};
+
+struct PlaybackStats {
+    uint64_t events = 0;
+    uint64_t framesShown = 0;
+    uint64_t framesDropped = 0;
+    size_t maxBacklog = 0;  // deepest ring occupancy seen by the consumer
+};
+
+class PlaybackRenderer {
+public:
+    PlaybackRenderer(FrameRenderer& renderer, const ShapeTable& shapes, PlaybackConfig config = {})
+        : renderer(renderer), shapes(shapes), config(config) {}
+
+    // Consumes events until GameOver; call from the render thread
+    PlaybackStats Run(EventRing& ring) {
+        for (int& c : cells) c = 0;
+        stats = PlaybackStats{};
+        frameInterval = std::chrono::milliseconds(1000 / (config.targetFps > 0 ? config.targetFps : 60));
+        deadline = Clock::now();
+
+        GameEvent e;
+        for (;;) {
+            if (!ring.TryPop(e)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            stats.events++;
+            size_t backlog = ring.Size();
+            if (backlog > stats.maxBacklog) stats.maxBacklog = backlog;
+
+            if (e.type == EventType::Spawn) {
+                score = e.score; lines = e.lines; level = e.level; next = e.next;
+                Present(e.piece, 0, 3, 0, config.spawnHoldMs, false);
+            } else if (e.type == EventType::Lock) {
+                for (int y = e.startY; y <= e.finalY; ++y) Present(e.piece, e.rotation, e.x, y, config.dropStepMs, true);
+                Lock(e.piece, e.rotation, e.x, e.finalY);
+                score = e.score; lines = e.lines; level = e.level;
+                Present(0, 0, 0, 0, config.lockHoldMs, false);
+            } else {
+                score = e.score; lines = e.lines; level = e.level;
+                Present(0, 0, 0, 0, 0, false);
+                return stats;
+            }
+        }
+    }
+
+    int Score() const { return score; }
+    int Lines() const { return lines; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const auto& ShapeOf(int piece, int rotation) const { return shapes[piece - 1][rotation & 3]; }
+
+    bool Fits(int piece, int rotation, int x, int y) const {
+        const auto& shape = ShapeOf(piece, rotation);
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                if (!shape[r][c]) continue;
+                int py = y + r, px = x + c;
+                if (px < 0 || px >= GRID_WIDTH || py >= GRID_HEIGHT) return false;
+                if (py >= 0 && cells[py * GRID_WIDTH + px]) return false;
+            }
+        }
+        return true;
+    }
+
+    void Lock(int piece, int rotation, int x, int y) {
+        const auto& shape = ShapeOf(piece, rotation);
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                int py = y + r, px = x + c;
+                if (shape[r][c] && py >= 0 && py < GRID_HEIGHT && px >= 0 && px < GRID_WIDTH)
+                    cells[py * GRID_WIDTH + px] = shape[r][c];
+            }
+        }
+        int write = GRID_HEIGHT - 1;
+        for (int read = GRID_HEIGHT - 1; read >= 0; --read) {
+            bool full = true;
+            for (int c = 0; c < GRID_WIDTH; ++c) full = full && cells[read * GRID_WIDTH + c];
+            if (full) continue;
+            if (write != read)
+                for (int c = 0; c < GRID_WIDTH; ++c) cells[write * GRID_WIDTH + c] = cells[read * GRID_WIDTH + c];
+            --write;
+        }
+        for (; write >= 0; --write)
+            for (int c = 0; c < GRID_WIDTH; ++c) cells[write * GRID_WIDTH + c] = 0;
+    }
+
+    // piece == 0 draws the board alone. Droppable frames are skipped while behind schedule.
+    void Present(int piece, int rotation, int x, int y, int holdMs, bool droppable) {
+        auto hold = std::chrono::milliseconds(holdMs) > frameInterval ? std::chrono::milliseconds(holdMs) : frameInterval;
+        auto now = Clock::now();
+        if (now - deadline > std::chrono::milliseconds(config.maxLagMs)) deadline = now;
+        if (droppable && now > deadline + frameInterval) {
+            stats.framesDropped++;
+            deadline += hold;
+            return;
+        }
+
+        int frameCells[GRID_HEIGHT * GRID_WIDTH];
+        for (int i = 0; i < GRID_HEIGHT * GRID_WIDTH; ++i) frameCells[i] = cells[i];
+        if (piece > 0 && Fits(piece, rotation, x, y)) {
+            const auto& shape = ShapeOf(piece, rotation);
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    if (shape[r][c] && y + r >= 0) frameCells[(y + r) * GRID_WIDTH + x + c] = shape[r][c];
+        }
+
+        int preview[16] = {};
+        if (next > 0) {
+            const auto& nextShape = ShapeOf(next, 0);
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c) preview[r * 4 + c] = nextShape[r][c];
+        }
+
+        FrameInput frame;
+        frame.cells = frameCells;
+        frame.preview = next > 0 ? preview : nullptr;
+        frame.score = score;
+        frame.lines = lines;
+        frame.level = level;
+        renderer.Render(frame);
+        stats.framesShown++;
+
+        deadline += hold;
+        if (Clock::now() < deadline) std::this_thread::sleep_until(deadline);
+    }
+
+    FrameRenderer& renderer;
+    const ShapeTable& shapes;
+    PlaybackConfig config;
+    PlaybackStats stats;
+
+    int cells[GRID_HEIGHT * GRID_WIDTH] = {};
+    int score = 0, lines = 0, level = 1, next = 0;
+    Clock::duration frameInterval{};
+    Clock::time_point deadline;
+};
+
+} // namespace TetrisConsole
+
+#endif // TETRIS_PIPELINE_H
@@ -0,0 +1,156 @@
+#ifndef TETRIS_PROFILER_H
+#define TETRIS_PROFILER_H
+
+// Hot-path probes for the Tetris engine.
+//
+//   -DTETRIS_PROFILE               enable probes (rdtsc ticks on x86, steady_clock ns elsewhere)
+//   -DTETRIS_PROFILE_STEADY_CLOCK  force steady_clock even on x86
+//
+// Without TETRIS_PROFILE every TETRIS_PROBE expands to nothing. Counters are per thread and
+// never locked; call Dump() after worker threads have finished.
+
+#include <cstdint>
+#include <ostream>
+
+#ifdef TETRIS_PROFILE
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(TETRIS_PROFILE_STEADY_CLOCK)
+#include <x86intrin.h>
+#define TETRIS_PROFILE_RDTSC 1
+#endif
+#endif
+
+namespace TetrisEngine {
+namespace Profiler {
+
+enum Phase {
+    DROP = 0,        // locating the landing row of a placement
+    PLACE,           // BoardEngine::PlacePiece
+    CLEAR,           // BoardEngine::ClearLines
+    FEATURES,        // height / holes / bumpiness extraction
+    FIND_BEST_MOVE,  // whole move search (includes the phases above)
+    SIMULATE_GAME,   // whole fitness game
+    PHASE_COUNT
+};
+
+inline const char* PhaseName(int phase) {
+    static const char* names[PHASE_COUNT] = {
+        "Drop", "PlacePiece", "ClearLines", "Features", "FindBestMove", "SimulateGame"
+    };
+    return names[phase];
+}
+
+#ifdef TETRIS_PROFILE
+
+constexpr bool Enabled = true;
+constexpr int MAX_THREADS = 256;
+
+// One cache line multiple per thread, so probes on different threads never share a line
+struct alignas(64) Counters {
+    uint64_t calls[PHASE_COUNT] = {};
+    uint64_t ticks[PHASE_COUNT] = {};
+};
+
+inline uint64_t ReadTicks() {
+#ifdef TETRIS_PROFILE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline const char* TickUnit() {
+#ifdef TETRIS_PROFILE_RDTSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+// Each thread claims a slot once; slots outlive their threads so Dump() still sees them
+inline Counters* Slots() {
+    static Counters slots[MAX_THREADS];
+    return slots;
+}
+
+inline std::atomic<int>& SlotCount() {
+    static std::atomic<int> count{0};
+    return count;
+}
+
+inline Counters& Local() {
+    static Counters overflow; // shared by threads beyond MAX_THREADS (counts may race)
+    thread_local Counters* mine = [] {
+        int slot = SlotCount().fetch_add(1, std::memory_order_relaxed);
+        return slot < MAX_THREADS ? &Slots()[slot] : &overflow;
+    }();
+    return *mine;
+}
+
+class ScopedProbe {
+public:
+    explicit ScopedProbe(Phase p) : phase(p), start(ReadTicks()) {}
+    ~ScopedProbe() {
+        Counters& c = Local();
+        c.calls[phase]++;
+        c.ticks[phase] += ReadTicks() - start;
+    }
+    ScopedProbe(const ScopedProbe&) = delete;
+    ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+private:
+    Phase phase;
+    uint64_t start;
+};
+
+inline void Reset() {
+    int n = SlotCount().load();
+    for (int i = 0; i < n && i < MAX_THREADS; ++i) Slots()[i] = Counters{};
+}
+
+inline void Dump(std::ostream& out) {
+    Counters total;
+    int n = SlotCount().load();
+    for (int i = 0; i < n && i < MAX_THREADS; ++i) {
+        for (int p = 0; p < PHASE_COUNT; ++p) {
+            total.calls[p] += Slots()[i].calls[p];
+            total.ticks[p] += Slots()[i].ticks[p];
+        }
+    }
+
+    out << "--- Profile (" << (n < MAX_THREADS ? n : MAX_THREADS) << " threads, " << TickUnit() << ") ---\n"
+        << std::left << std::setw(14) << "Phase" << std::right
+        << std::setw(14) << "Calls" << std::setw(18) << "Total" << std::setw(12) << "Mean" << "\n";
+    for (int p = 0; p < PHASE_COUNT; ++p) {
+        double mean = total.calls[p] ? static_cast<double>(total.ticks[p]) / total.calls[p] : 0.0;
+        out << std::left << std::setw(14) << PhaseName(p) << std::right
+            << std::setw(14) << total.calls[p] << std::setw(18) << total.ticks[p]
+            << std::setw(12) << std::fixed << std::setprecision(1) << mean << "\n";
+    }
+}
+
+#define TETRIS_PROBE_CONCAT_INNER(a, b) a##b
+#define TETRIS_PROBE_CONCAT(a, b) TETRIS_PROBE_CONCAT_INNER(a, b)
+#define TETRIS_PROBE(phase) \
+    ::TetrisEngine::Profiler::ScopedProbe TETRIS_PROBE_CONCAT(tetrisProbe_, __LINE__)(::TetrisEngine::Profiler::phase)
+
+#else
+
+constexpr bool Enabled = false;
+
+inline void Reset() {}
+inline void Dump(std::ostream& out) {
+    out << "Profiling disabled: rebuild with -DTETRIS_PROFILE\n";
+}
+
+#define TETRIS_PROBE(phase) ((void)0)
+
+#endif // TETRIS_PROFILE
+
+} // namespace Profiler
+} // namespace TetrisEngine
+
+#endif // TETRIS_PROFILER_H
@@ -0,0 +1,48 @@
+#ifndef TETRIS_PROTOCOL_H
+#define TETRIS_PROTOCOL_H
+
+// Wire format of the local Tetris AI service (_tetris/TetrisServer.cpp).
+//
+// A client writes fixed-size MoveRequests back to back on a stream socket and may keep
+// any number outstanding; the server answers each with a MoveResponse carrying the same
+// id. Responses of one connection may arrive out of order. Integers are little-endian.
+
+#include <cstdint>
+
+namespace TetrisEngine {
+namespace Protocol {
+
+constexpr const char* DEFAULT_SOCKET_PATH = "/tmp/tetris_ai.sock";
+
+#pragma pack(push, 1)
+struct MoveRequest {
+    uint32_t id;
+    uint8_t piece;          // 1..7
+    uint8_t reserved[2];
+    uint8_t board[25];      // BoardEngine::PackBits layout: bit r * 10 + c, LSB first
+};
+
+struct MoveResponse {
+    uint32_t id;
+    int8_t rotation;
+    int8_t x;
+    int8_t y;               // landing row
+    uint8_t status;         // STATUS_*
+    float score;
+    uint32_t evaluated;     // placements scored
+};
+#pragma pack(pop)
+
+static_assert(sizeof(MoveRequest) == 32, "MoveRequest layout changed");
+static_assert(sizeof(MoveResponse) == 16, "MoveResponse layout changed");
+
+enum Status : uint8_t {
+    STATUS_OK = 0,
+    STATUS_GAME_OVER = 1,   // the piece cannot spawn on this board
+    STATUS_BAD_PIECE = 2
+};
+
+} // namespace Protocol
+} // namespace TetrisEngine
+
+#endif // TETRIS_PROTOCOL_H
@@ -0,0 +1,224 @@
+#ifndef TETRIS_RENDERER_H
+#define TETRIS_RENDERER_H
+
+// Diff-based console renderer shared by the Tetris front-ends (TetrisBoard.cpp,
+// TetrisBoardStateless.cpp, tetris.cpp). The whole frame (title, walls, board, preview,
+// stats) is composed into a character grid; only cells that differ from the previous
+// frame are emitted, as one escape-sequence buffer written with a single fwrite.
+// Plain (non-fancy) mode targets terminals without escape support and prints the
+// full frame as text, still in a single write.
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace TetrisConsole {
+
+constexpr int GRID_WIDTH  = 10;
+constexpr int GRID_HEIGHT = 20;
+
+// Screen layout: title row, top wall, GRID_HEIGHT board rows, bottom wall
+constexpr int FRAME_ROWS = GRID_HEIGHT + 3;
+constexpr int FRAME_COLS = 48;
+
+enum Style : uint8_t {
+    STYLE_DEFAULT = 0,
+    STYLE_PIECE_I, STYLE_PIECE_O, STYLE_PIECE_T, STYLE_PIECE_S,
+    STYLE_PIECE_Z, STYLE_PIECE_J, STYLE_PIECE_L,
+    STYLE_EMPTY,
+    STYLE_WALL,
+    STYLE_PREVIEW,
+    STYLE_COUNT
+};
+
+inline const char* StyleEscape(uint8_t style) {
+    static const char* escapes[STYLE_COUNT] = {
+        "\033[0m",
+        "\033[1;36m", "\033[1;33m", "\033[1;35m", "\033[1;32m",
+        "\033[1;31m", "\033[1;34m", "\033[1;91m",
+        "\033[1;30m",
+        "\033[1;37m",
+        "\033[1;90m"
+    };
+    return escapes[style];
+}
+
+struct FrameInput {
+    const int* cells = nullptr;   // GRID_HEIGHT * GRID_WIDTH piece ids, row-major, 0 = empty
+    const int* preview = nullptr; // 4x4 next-piece shape (row-major), or nullptr
+    int score = 0;
+    int lines = 0;
+    int level = 0;
+    const char* title = "--- AI Playing ---";
+};
+
+class FrameRenderer {
+public:
+    explicit FrameRenderer(bool fancy = true) : fancy(fancy) {
+        out.reserve(8192);
+        Invalidate();
+    }
+
+    // Forces the next Render() to clear the screen and repaint everything
+    void Invalidate() { valid = false; }
+
+    void Render(const FrameInput& in) {
+        Compose(in);
+
+        out.clear();
+        if (!fancy) {
+            ComposePlainText();
+            Write();
+            return;
+        }
+        if (!valid) {
+            // After a clear the terminal matches an all-blank frame
+            out += "\033[2J\033[H";
+            for (auto& row : prev) for (auto& cell : row) cell = Cell{};
+            cursorRow = cursorCol = 0;
+            currentStyle = STYLE_DEFAULT;
+            out += StyleEscape(STYLE_DEFAULT);
+        }
+
+        for (int r = 0; r < FRAME_ROWS; ++r) {
+            for (int c = 0; c < FRAME_COLS; ++c) {
+                const Cell& cell = next[r][c];
+                if (cell == prev[r][c]) continue;
+                if (r != cursorRow || c != cursorCol) MoveCursor(r, c);
+                if (cell.style != currentStyle && cell.glyph != ' ') {
+                    out += StyleEscape(cell.style);
+                    currentStyle = cell.style;
+                }
+                AppendUtf8(cell.glyph);
+                prev[r][c] = cell;
+                cursorCol = c + 1;
+            }
+        }
+
+        if (!out.empty()) {
+            // Park the cursor below the frame so other output does not overwrite it
+            if (currentStyle != STYLE_DEFAULT) {
+                out += StyleEscape(STYLE_DEFAULT);
+                currentStyle = STYLE_DEFAULT;
+            }
+            MoveCursor(FRAME_ROWS, 0);
+            Write();
+        }
+        valid = true;
+    }
+
+    size_t LastFrameBytes() const { return out.size(); }
+
+private:
+    struct Cell {
+        uint32_t glyph = ' ';
+        uint8_t style = STYLE_DEFAULT;
+        bool operator==(const Cell& o) const { return glyph == o.glyph && style == o.style; }
+    };
+
+    void Put(int row, int col, const char* utf8, uint8_t style) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(utf8);
+        while (*p && col < FRAME_COLS) {
+            uint32_t cp = *p++;
+            if (cp >= 0xF0)      { cp &= 0x07; for (int i = 0; i < 3 && *p; ++i) cp = (cp << 6) | (*p++ & 0x3F); }
+            else if (cp >= 0xE0) { cp &= 0x0F; for (int i = 0; i < 2 && *p; ++i) cp = (cp << 6) | (*p++ & 0x3F); }
+            else if (cp >= 0xC0) { cp &= 0x1F; if (*p) cp = (cp << 6) | (*p++ & 0x3F); }
+            next[row][col++] = Cell{cp, cp == ' ' ? static_cast<uint8_t>(STYLE_DEFAULT) : style};
+        }
+    }
+
+    void Put(int row, int col, const std::string& text, uint8_t style) { Put(row, col, text.c_str(), style); }
+
+    void Compose(const FrameInput& in) {
+        for (auto& row : next) for (auto& cell : row) cell = Cell{};
+
+        const char* top    = fancy ? "╔═════════════════════╗" : "+----------------------+";
+        const char* bottom = fancy ? "╚═════════════════════╝" : "+----------------------+";
+        const char* wall   = fancy ? "║" : "|";
+        const char* block  = fancy ? "■" : "#";
+
+        Put(0, 0, in.title, STYLE_DEFAULT);
+        Put(1, 0, top, STYLE_WALL);
+        for (int r = 0; r < GRID_HEIGHT; ++r) {
+            int row = r + 2;
+            Put(row, 0, wall, STYLE_WALL);
+            for (int c = 0; c < GRID_WIDTH; ++c) {
+                int id = in.cells[r * GRID_WIDTH + c];
+                if (id == 0) Put(row, 2 + 2 * c, ".", STYLE_EMPTY);
+                else Put(row, 2 + 2 * c, block, static_cast<uint8_t>(id >= 1 && id <= 7 ? id : STYLE_DEFAULT));
+            }
+            Put(row, 2 * GRID_WIDTH + 2, wall, STYLE_WALL);
+
+            int side = 2 * GRID_WIDTH + 3;
+            if (r == 0) Put(row, side + 6, "Next", STYLE_PREVIEW);
+            else if (r == 1) Put(row, side + 6, fancy ? "────" : "----", STYLE_PREVIEW);
+            else if (r >= 2 && r <= 5 && in.preview) {
+                for (int c = 0; c < 4; ++c) {
+                    int id = in.preview[(r - 2) * 4 + c];
+                    if (id != 0) Put(row, side + 6 + 2 * c, block, static_cast<uint8_t>(id));
+                }
+            }
+            if (r == 7) Put(row, side + 2, "Score: " + std::to_string(in.score), STYLE_DEFAULT);
+            if (r == 9) Put(row, side + 2, "Lines: " + std::to_string(in.lines), STYLE_DEFAULT);
+            if (r == 11) Put(row, side + 2, "Level: " + std::to_string(in.level), STYLE_DEFAULT);
+        }
+        Put(GRID_HEIGHT + 2, 0, bottom, STYLE_WALL);
+    }
+
+    void ComposePlainText() {
+        out += "\n\n";
+        for (int r = 0; r < FRAME_ROWS; ++r) {
+            int end = FRAME_COLS;
+            while (end > 0 && next[r][end - 1].glyph == ' ') --end;
+            for (int c = 0; c < end; ++c) AppendUtf8(next[r][c].glyph);
+            out += '\n';
+        }
+    }
+
+    // std::cout may hold pending text from the caller; keep ordering before the raw write
+    void Write() {
+        std::cout.flush();
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        std::fflush(stdout);
+    }
+
+    void MoveCursor(int row, int col) {
+        char buf[24];
+        int n = std::snprintf(buf, sizeof(buf), "\033[%d;%dH", row + 1, col + 1);
+        out.append(buf, static_cast<size_t>(n));
+        cursorRow = row;
+        cursorCol = col;
+    }
+
+    void AppendUtf8(uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool fancy;
+    bool valid = false;
+    Cell next[FRAME_ROWS][FRAME_COLS];
+    Cell prev[FRAME_ROWS][FRAME_COLS];
+    int cursorRow = 0, cursorCol = 0;
+    uint8_t currentStyle = STYLE_DEFAULT;
+    std::string out;
+};
+
+} // namespace TetrisConsole
+
+#endif // TETRIS_RENDERER_H
@@ -0,0 +1,168 @@
+#ifndef TETRIS_REPLAY_H
+#define TETRIS_REPLAY_H
+
+// Compact replays of TetrisGameInstance games.
+//
+// File layout: FileHeader followed by moveCount little-endian uint16 move records
+// (see EncodeReplayMove in TetrisEngine.h). A 500-move game is ~1 KB instead of
+// 500 GetState snapshots. Deserialize rejects a log if any move fails IsValidReplayMove.
+// Keyframes are not stored: Decoder::Attach rebuilds them with one decoding pass, after
+// which any frame is at most keyframeInterval-1 moves away.
+
+#include "TetrisEngine.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace TetrisEngine {
+namespace Replay {
+
+#pragma pack(push, 1)
+struct FileHeader {
+    char magic[4];       // "TTRP"
+    uint16_t version;
+    uint16_t flags;
+    uint32_t seed;
+    uint32_t moveCount;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader layout changed");
+
+constexpr uint16_t FORMAT_VERSION = 1;
+constexpr uint16_t FLAG_GAME_OVER = 1;
+
+inline std::vector<uint8_t> Serialize(const ReplayLog& log) {
+    FileHeader header;
+    std::memcpy(header.magic, "TTRP", 4);
+    header.version = FORMAT_VERSION;
+    header.flags = log.gameOver ? FLAG_GAME_OVER : 0;
+    header.seed = log.seed;
+    header.moveCount = static_cast<uint32_t>(log.moves.size());
+
+    std::vector<uint8_t> bytes(sizeof(header) + log.moves.size() * sizeof(uint16_t));
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    if (!log.moves.empty())
+        std::memcpy(bytes.data() + sizeof(header), log.moves.data(), log.moves.size() * sizeof(uint16_t));
+    return bytes;
+}
+
+inline bool Deserialize(const uint8_t* data, size_t size, ReplayLog& log) {
+    FileHeader header;
+    if (size < sizeof(header)) return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, "TTRP", 4) != 0 || header.version != FORMAT_VERSION) return false;
+    if (size < sizeof(header) + static_cast<size_t>(header.moveCount) * sizeof(uint16_t)) return false;
+
+    std::vector<uint16_t> moves(header.moveCount);
+    if (header.moveCount)
+        std::memcpy(moves.data(), data + sizeof(header), header.moveCount * sizeof(uint16_t));
+    for (uint16_t m : moves)
+        if (!IsValidReplayMove(DecodeReplayMove(m))) return false;
+
+    log.seed = header.seed;
+    log.gameOver = (header.flags & FLAG_GAME_OVER) != 0;
+    log.moves = std::move(moves);
+    return true;
+}
+
+inline bool SaveFile(const std::string& path, const ReplayLog& log) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+    auto bytes = Serialize(log);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return file.good();
+}
+
+inline bool LoadFile(const std::string& path, ReplayLog& log) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    // tellg() is -1 on failure and huge for a directory on some platforms
+    std::streamoff size = file.tellg();
+    const std::streamoff maxSize = sizeof(FileHeader) + std::streamoff(UINT32_MAX) * sizeof(uint16_t);
+    if (size < 0 || size > maxSize) return false;
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return file.good() && Deserialize(bytes.data(), bytes.size(), log);
+}
+
+// Board and counters after the first 'move' placements, in GetState layout
+struct Frame {
+    int move = 0;
+    int cells[BOARD_WIDTH * BOARD_HEIGHT] = {};
+    int score = 0, lines = 0, level = 0;
+    int piece = 0;  // last placed piece (0 before the first move)
+    int next = 0;   // piece placed by the following move (0 at the end)
+};
+
+class Decoder {
+public:
+    explicit Decoder(int keyframeInterval = 64)
+        : interval(keyframeInterval > 0 ? keyframeInterval : 64) {}
+
+    void Attach(const ReplayLog& log) {
+        moves = log.moves;
+        keyframes.clear();
+
+        State s;
+        for (size_t i = 0; i <= moves.size(); ++i) {
+            if (i % interval == 0) keyframes.push_back(s);
+            if (i < moves.size()) Apply(s, moves[i]);
+        }
+    }
+
+    int MoveCount() const { return static_cast<int>(moves.size()); }
+
+    bool Seek(int move, Frame& out) const {
+        if (move < 0 || move > MoveCount() || keyframes.empty()) return false;
+        State s = keyframes[move / interval];
+        for (int i = (move / interval) * interval; i < move; ++i) Apply(s, moves[i]);
+
+        const auto& grid = s.board.GetGrid();
+        for (int r = 0; r < BOARD_HEIGHT; ++r)
+            for (int c = 0; c < BOARD_WIDTH; ++c) out.cells[r * BOARD_WIDTH + c] = grid[r][c];
+        out.move = move;
+        out.score = s.score;
+        out.lines = s.lines;
+        out.level = s.level;
+        out.piece = move > 0 ? DecodeReplayMove(moves[move - 1]).piece : 0;
+        out.next = move < MoveCount() ? DecodeReplayMove(moves[move]).piece : 0;
+        return true;
+    }
+
+    // Replays every move and returns the final line count; used to measure raw decode speed
+    int DecodeAll() const {
+        State s;
+        for (uint16_t m : moves) Apply(s, m);
+        return s.lines;
+    }
+
+private:
+    // Mirrors TetrisGameInstance scoring, including its level starting at 0 after Reset
+    struct State {
+        BoardEngine board;
+        int score = 0, lines = 0, level = 0;
+    };
+
+    static void Apply(State& s, uint16_t m) {
+        ReplayMove mv = DecodeReplayMove(m);
+        s.board.PlacePiece({mv.piece, mv.rotation, mv.x, mv.y});
+        int cleared = s.board.ClearLines();
+        if (cleared) {
+            s.lines += cleared;
+            s.score += cleared * cleared * 100 * s.level;
+            s.level = 1 + (s.lines / 10);
+        }
+    }
+
+    int interval;
+    std::vector<uint16_t> moves;
+    std::vector<State> keyframes;
+};
+
+} // namespace Replay
+} // namespace TetrisEngine
+
+#endif // TETRIS_REPLAY_H
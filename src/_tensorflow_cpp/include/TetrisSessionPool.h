@@ -0,0 +1,265 @@
+#ifndef TETRIS_SESSION_POOL_H
+#define TETRIS_SESSION_POOL_H
+
+// Pool of concurrent Tetris sessions for the backend.
+//
+// Sessions live in fixed-size slabs (no per-session heap object) and hold a 40-byte
+// Bitboard plus a 4-bit color plane, a private splitmix64 RNG and a spinlock, so any
+// thread may step any session and StepAll can advance every active session in parallel.
+// Handles carry a generation count, so a handle to a destroyed (and reused) slot is
+// rejected instead of touching another user's game.
+
+#include "TetrisBitboard.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace TetrisEngine {
+
+typedef uint64_t SessionHandle; // (generation << 32) | slot, 0 is never valid
+
+struct SessionStats {
+    int score = 0, lines = 0, level = 1;
+    int currentPiece = 0, nextPiece = 0;
+    int moves = 0;
+    bool gameOver = false;
+};
+
+class SessionPool {
+public:
+    static constexpr int SLAB_SESSIONS = 1024;
+    static constexpr int MAX_SLABS = 1024;   // up to ~1M sessions
+
+    explicit SessionPool(const HeuristicWeights& w = {0.760666, -0.510066, -0.35663, -0.184483})
+        : weights(w) {}
+
+    SessionPool(const SessionPool&) = delete;
+    SessionPool& operator=(const SessionPool&) = delete;
+
+    SessionHandle Create(uint64_t seed) {
+        uint32_t slot;
+        {
+            std::lock_guard<std::mutex> lock(allocMutex);
+            if (freeSlots.empty()) GrowLocked();
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        Session& s = At(slot);
+        SpinGuard guard(s.lock);
+        s.generation = s.generation + 1 == 0 ? 1 : s.generation + 1;
+        s.rng = seed;
+        s.board.Reset();
+        std::memset(s.colors, 0, sizeof(s.colors));
+        s.score = s.lines = s.moves = 0;
+        s.level = 1;
+        s.current = 0;
+        s.next = static_cast<int8_t>(NextPiece(s.rng));
+        s.gameOver = false;
+        s.active.store(true, std::memory_order_release);
+        active.fetch_add(1, std::memory_order_relaxed);
+        return (static_cast<uint64_t>(s.generation) << 32) | slot;
+    }
+
+    bool Destroy(SessionHandle h) {
+        Session* s = Resolve(h);
+        if (!s) return false;
+        {
+            SpinGuard guard(s->lock);
+            if (!Owns(*s, h)) return false;
+            s->active.store(false, std::memory_order_release);
+        }
+        active.fetch_sub(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(allocMutex);
+        freeSlots.push_back(static_cast<uint32_t>(h & 0xFFFFFFFFu));
+        return true;
+    }
+
+    // Advances one session by up to 'steps' placements; returns placements made
+    int Step(SessionHandle h, int steps = 1) {
+        Session* s = Resolve(h);
+        if (!s) return 0;
+        SpinGuard guard(s->lock);
+        if (!Owns(*s, h)) return 0;
+        int made = 0;
+        while (made < steps && StepLocked(*s)) ++made;
+        return made;
+    }
+
+    // board (optional) receives BOARD_HEIGHT x BOARD_WIDTH piece ids in GetState layout
+    bool GetState(SessionHandle h, int* board, SessionStats* stats) {
+        Session* s = Resolve(h);
+        if (!s) return false;
+        SpinGuard guard(s->lock);
+        if (!Owns(*s, h)) return false;
+        if (board) {
+            for (int r = 0; r < BOARD_HEIGHT; ++r)
+                for (int c = 0; c < BOARD_WIDTH; ++c) board[r * BOARD_WIDTH + c] = ColorAt(*s, r, c);
+        }
+        if (stats) {
+            stats->score = s->score; stats->lines = s->lines; stats->level = s->level;
+            stats->currentPiece = s->current; stats->nextPiece = s->next;
+            stats->moves = s->moves; stats->gameOver = s->gameOver;
+        }
+        return true;
+    }
+
+    // Steps every active session once, spreading slabs over 'threads' workers (0 = all cores).
+    // Returns the number of placements made.
+    uint64_t StepAll(int threads = 0) {
+        int slabs = slabCount.load(std::memory_order_acquire);
+        if (threads <= 0) threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        threads = std::min(threads, std::max(1, slabs));
+
+        std::atomic<int> nextSlab{0};
+        std::atomic<uint64_t> placed{0};
+        auto worker = [&] {
+            uint64_t local = 0;
+            for (int sl = nextSlab.fetch_add(1); sl < slabs; sl = nextSlab.fetch_add(1)) {
+                Session* slab = this->slabs[sl].get();
+                for (int i = 0; i < SLAB_SESSIONS; ++i) {
+                    Session& s = slab[i];
+                    if (!s.active.load(std::memory_order_acquire)) continue;
+                    SpinGuard guard(s.lock);
+                    if (s.active.load(std::memory_order_relaxed) && StepLocked(s)) ++local;
+                }
+            }
+            placed.fetch_add(local, std::memory_order_relaxed);
+        };
+
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+        return placed.load();
+    }
+
+    size_t ActiveCount() const { return active.load(std::memory_order_relaxed); }
+
+    // Slab memory plus free-list capacity
+    size_t BytesAllocated() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return static_cast<size_t>(slabCount.load()) * SLAB_SESSIONS * sizeof(Session) +
+               freeSlots.capacity() * sizeof(uint32_t);
+    }
+
+    static constexpr size_t SessionBytes() { return sizeof(Session); }
+
+private:
+    struct alignas(64) Session {
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+        std::atomic<bool> active{false};
+        int8_t current = 0, next = 0;
+        bool gameOver = false;
+        uint32_t generation = 0;
+        int32_t score = 0, lines = 0, level = 1, moves = 0;
+        uint64_t rng = 0;
+        Bitboard board;
+        uint8_t colors[BOARD_HEIGHT][BOARD_WIDTH / 2] = {}; // two 4-bit piece ids per byte
+    };
+
+    class SpinGuard {
+    public:
+        explicit SpinGuard(std::atomic_flag& f) : flag(f) {
+            while (flag.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+        }
+        ~SpinGuard() { flag.clear(std::memory_order_release); }
+    private:
+        std::atomic_flag& flag;
+    };
+
+    static uint64_t SplitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    static int NextPiece(uint64_t& state) {
+        return 1 + static_cast<int>(((SplitMix64(state) >> 32) * 7) >> 32);
+    }
+
+    static int ColorAt(const Session& s, int r, int c) {
+        return (s.colors[r][c >> 1] >> ((c & 1) * 4)) & 0xF;
+    }
+
+    static void SetColor(Session& s, int r, int c, int id) {
+        uint8_t& b = s.colors[r][c >> 1];
+        int shift = (c & 1) * 4;
+        b = static_cast<uint8_t>((b & ~(0xF << shift)) | (id << shift));
+    }
+
+    bool StepLocked(Session& s) {
+        if (s.gameOver) return false;
+        s.current = s.next;
+        s.next = static_cast<int8_t>(NextPiece(s.rng));
+        if (s.board.IsGameOver(s.current)) {
+            s.gameOver = true;
+            return false;
+        }
+
+        Move m = FindBestMove(s.board, s.current, weights);
+        int y = s.board.DropY(s.current, m.rotation, m.x);
+        if (y == Bitboard::INVALID_Y) {
+            s.gameOver = true;
+            return false;
+        }
+
+        s.board.Place(s.current, m.rotation, m.x, y);
+        const auto& shape = TETROMINO_SHAPES[s.current - 1][m.rotation];
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                if (shape[r][c]) SetColor(s, y + r, m.x + c, s.current);
+
+        uint32_t clearedRows = 0;
+        int cleared = s.board.ClearLines(&clearedRows);
+        if (cleared) {
+            int write = BOARD_HEIGHT - 1;
+            for (int read = BOARD_HEIGHT - 1; read >= 0; --read) {
+                if (clearedRows & (1u << read)) continue;
+                if (write != read) std::memcpy(s.colors[write], s.colors[read], sizeof(s.colors[0]));
+                --write;
+            }
+            for (; write >= 0; --write) std::memset(s.colors[write], 0, sizeof(s.colors[0]));
+
+            s.lines += cleared;
+            s.score += cleared * cleared * 100 * s.level;
+            s.level = 1 + (s.lines / 10);
+        }
+        s.moves++;
+        return true;
+    }
+
+    void GrowLocked() {
+        int n = slabCount.load(std::memory_order_relaxed);
+        if (n >= MAX_SLABS) throw std::bad_alloc();
+        slabs[n].reset(new Session[SLAB_SESSIONS]);
+        for (int i = SLAB_SESSIONS - 1; i >= 0; --i) freeSlots.push_back(static_cast<uint32_t>(n * SLAB_SESSIONS + i));
+        slabCount.store(n + 1, std::memory_order_release); // publish after the slab exists
+    }
+
+    Session& At(uint32_t slot) { return slabs[slot / SLAB_SESSIONS][slot % SLAB_SESSIONS]; }
+
+    Session* Resolve(SessionHandle h) {
+        uint32_t slot = static_cast<uint32_t>(h & 0xFFFFFFFFu);
+        if (slot / SLAB_SESSIONS >= static_cast<uint32_t>(slabCount.load(std::memory_order_acquire))) return nullptr;
+        return &At(slot);
+    }
+
+    static bool Owns(const Session& s, SessionHandle h) {
+        return s.active.load(std::memory_order_relaxed) && s.generation == static_cast<uint32_t>(h >> 32);
+    }
+
+    HeuristicWeights weights;
+    std::unique_ptr<Session[]> slabs[MAX_SLABS];
+    std::atomic<int> slabCount{0};
+    std::atomic<size_t> active{0};
+    mutable std::mutex allocMutex;
+    std::vector<uint32_t> freeSlots;
+};
+
+} // namespace TetrisEngine
+
+#endif // TETRIS_SESSION_POOL_H
@@ -0,0 +1,245 @@
+#ifndef TETRIS_SOLVER_H
+#define TETRIS_SOLVER_H
+
+// Offline placement solver for a fully known piece sequence.
+//
+// Beam search over Bitboards: each depth expands every beam node with all placements
+// of the next piece, merges children that reach the same board (keeping the most lines),
+// and keeps the best 'beamWidth' by lines plus a board-quality heuristic. Memory is
+// bounded by the beam (two generations of boards plus a 6-byte back-pointer, parent index
+// and replay move, per kept node per depth). The expansion of each depth is split across
+// worker threads; duplicates are merged per hash bucket so no locks are taken.
+//
+// The result is the best line count found, not a proof of optimality.
+
+#include "TetrisBitboard.h"
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace TetrisEngine {
+namespace Solver {
+
+// Piece ids drawn exactly like TetrisGameInstance::Reset(seed) and the GA's SimulateGame
+inline std::vector<int> SeededSequence(uint32_t seed, int count) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(1, 7);
+    std::vector<int> pieces(count);
+    for (auto& p : pieces) p = dist(rng);
+    return pieces;
+}
+
+inline uint64_t HashBoard(const Bitboard& b) {
+    uint64_t words[5];
+    std::memcpy(words, b.rows, sizeof(words));
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    for (uint64_t w : words) {
+        h ^= w + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        h *= 0xBF58476D1CE4E5B9ull;
+    }
+    return h ^ (h >> 31);
+}
+
+struct SolverConfig {
+    int beamWidth = 4096;
+    int threads = 0;            // 0 = all cores
+    HeuristicWeights weights{0.760666, -0.510066, -0.35663, -0.184483};
+    double lineValue = 4.0;     // ranking bonus per line already cleared
+};
+
+struct SolverResult {
+    int lines = 0;
+    int placed = 0;                 // pieces placed on the best path (< horizon if every path topped out)
+    std::vector<uint16_t> moves;    // EncodeReplayMove() per placement, replayable with TetrisReplay.h
+    uint64_t nodes = 0;             // children generated
+    uint64_t duplicates = 0;        // children merged into an identical board
+    double seconds = 0.0;
+    int threads = 1;
+};
+
+class BeamSolver {
+public:
+    explicit BeamSolver(const SolverConfig& cfg = {}) : config(cfg) {}
+
+    SolverResult Solve(const std::vector<int>& pieces) {
+        SolverResult result;
+        int threads = config.threads > 0 ? config.threads
+                                         : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        result.threads = threads;
+        auto start = std::chrono::steady_clock::now();
+
+        beam.assign(1, Node{});
+        history.clear();
+        std::vector<Worker> workers(threads);
+        for (auto& w : workers) w.buckets.resize(threads);
+
+        int depth = 0;
+        bool stop = false;
+        std::barrier sync(threads);
+
+        auto run = [&](int t) {
+            Worker& self = workers[t];
+            while (true) {
+                // Phase 1: expand a slice of the beam into per-bucket child lists
+                for (auto& bucket : self.buckets) bucket.clear();
+                int piece = pieces[depth];
+                size_t begin = beam.size() * t / threads, end = beam.size() * (t + 1) / threads;
+                uint64_t made = 0;
+                for (size_t i = begin; i < end; ++i) made += Expand(beam[i], static_cast<int32_t>(i), piece, self, threads);
+                self.nodes += made;
+                sync.arrive_and_wait();
+
+                // Phase 2: merge duplicates of bucket t across all workers
+                self.unique.clear();
+                self.index.clear();
+                for (auto& other : workers) {
+                    for (const Node& child : other.buckets[t]) {
+                        auto [it, inserted] = self.index.try_emplace(child.hash, self.unique.size());
+                        if (inserted) { self.unique.push_back(child); continue; }
+                        // Hash hit: confirm the board; true collisions are chained through Node::chain
+                        size_t slot = it->second;
+                        while (slot != SIZE_MAX && !SameBoard(self.unique[slot], child)) slot = self.unique[slot].chain;
+                        if (slot == SIZE_MAX) {
+                            Node copy = child;
+                            copy.chain = it->second;
+                            it->second = self.unique.size();
+                            self.unique.push_back(copy);
+                        } else {
+                            self.duplicates++;
+                            if (child.lines > self.unique[slot].lines) {
+                                size_t chain = self.unique[slot].chain;
+                                self.unique[slot] = child;
+                                self.unique[slot].chain = chain;
+                            }
+                        }
+                    }
+                }
+                sync.arrive_and_wait();
+
+                // Phase 3 (one thread): keep the best beamWidth children, record back-pointers
+                if (t == 0) {
+                    next.clear();
+                    for (auto& w : workers) next.insert(next.end(), w.unique.begin(), w.unique.end());
+                    if (next.empty()) {
+                        stop = true;
+                    } else {
+                        if (static_cast<int>(next.size()) > config.beamWidth) {
+                            std::nth_element(next.begin(), next.begin() + config.beamWidth, next.end(),
+                                             [](const Node& a, const Node& b) {
+                                                 // hash tie-break keeps the beam independent of thread count
+                                                 return a.rank != b.rank ? a.rank > b.rank : a.hash < b.hash;
+                                             });
+                            next.resize(config.beamWidth);
+                        }
+                        std::vector<Step> steps(next.size());
+                        for (size_t i = 0; i < next.size(); ++i) steps[i] = {next[i].parent, next[i].move};
+                        history.push_back(std::move(steps));
+                        for (size_t i = 0; i < next.size(); ++i) next[i].parent = static_cast<int32_t>(i);
+                        beam.swap(next);
+                        depth++;
+                        stop = depth >= static_cast<int>(pieces.size());
+                    }
+                }
+                sync.arrive_and_wait();
+                if (stop) break;
+            }
+        };
+
+        if (!pieces.empty()) {
+            std::vector<std::thread> pool;
+            for (int t = 1; t < threads; ++t) pool.emplace_back(run, t);
+            run(0);
+            for (auto& th : pool) th.join();
+        }
+
+        // Best node of the deepest completed depth, then walk the back-pointers
+        size_t best = 0;
+        for (size_t i = 1; i < beam.size(); ++i)
+            if (beam[i].lines > beam[best].lines) best = i;
+        result.lines = beam.empty() ? 0 : beam[best].lines;
+        result.placed = static_cast<int>(history.size());
+        result.moves.resize(history.size());
+        int32_t at = static_cast<int32_t>(best);
+        for (int d = static_cast<int>(history.size()) - 1; d >= 0; --d) {
+            result.moves[d] = history[d][at].move;
+            at = history[d][at].parent;
+        }
+        for (const auto& w : workers) {
+            result.nodes += w.nodes;
+            result.duplicates += w.duplicates;
+        }
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+private:
+    struct Node {
+        Bitboard board;
+        int32_t lines = 0;
+        int32_t parent = -1;    // index in the previous beam
+        uint16_t move = 0;      // EncodeReplayMove of the placement that produced this node
+        double rank = 0.0;
+        uint64_t hash = 0;
+        size_t chain = SIZE_MAX; // next node with the same hash in Worker::unique
+    };
+
+    // Packed: one Step per kept node per depth, 6 bytes instead of a padded 8
+#pragma pack(push, 1)
+    struct Step {
+        int32_t parent;
+        uint16_t move;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(Step) == 6, "Step should stay packed");
+
+    struct Worker {
+        std::vector<std::vector<Node>> buckets;  // children by hash % threads
+        std::vector<Node> unique;
+        std::unordered_map<uint64_t, size_t> index;
+        uint64_t nodes = 0, duplicates = 0;
+    };
+
+    static bool SameBoard(const Node& a, const Node& b) {
+        return std::memcmp(a.board.rows, b.board.rows, sizeof(a.board.rows)) == 0;
+    }
+
+    size_t Expand(const Node& node, int32_t parent, int piece, Worker& w, int threads) const {
+        if (node.board.IsGameOver(piece)) return 0;
+        size_t made = 0;
+        for (int r = 0; r < 4; ++r) {
+            for (int x = -3; x < BOARD_WIDTH + 3; ++x) {
+                int y = node.board.DropY(piece, r, x);
+                if (y == Bitboard::INVALID_Y) continue;
+
+                Node child;
+                child.board = node.board;
+                child.board.Place(piece, r, x, y);
+                child.lines = node.lines + child.board.ClearLines();
+                child.parent = parent;
+                child.move = EncodeReplayMove(piece, r, x, y);
+                int height, holes, bump;
+                child.board.Features(height, holes, bump);
+                child.rank = child.lines * config.lineValue +
+                             height * config.weights.w_height +
+                             holes * config.weights.w_holes +
+                             bump * config.weights.w_bumpiness;
+                child.hash = HashBoard(child.board);
+                w.buckets[child.hash % threads].push_back(child);
+                made++;
+            }
+        }
+        return made;
+    }
+
+    SolverConfig config;
+    std::vector<Node> beam, next;
+    std::vector<std::vector<Step>> history;
+};
+
+} // namespace Solver
+} // namespace TetrisEngine
+
+#endif // TETRIS_SOLVER_H
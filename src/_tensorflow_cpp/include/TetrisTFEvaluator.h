@@ -0,0 +1,141 @@
+#ifndef TETRIS_TF_EVALUATOR_H
+#define TETRIS_TF_EVALUATOR_H
+
+#include "TetrisEngine.h"
+#include "tensorflow/c/c_api.h"
+#include <iostream>
+
+namespace TetrisEngine {
+
+// --- TensorFlow Value Network Evaluator ---
+// Scores all candidates of a move with a single TF_SessionRun on an [N, FEATURE_COUNT]
+// float tensor; the model must output one value per row ([N] or [N, 1]).
+// Without a loaded model it falls back to the linear heuristic.
+class TFValueEvaluator {
+public:
+    HeuristicWeights fallback;
+
+    TFValueEvaluator() = default;
+    TFValueEvaluator(const TFValueEvaluator&) = delete;
+    TFValueEvaluator& operator=(const TFValueEvaluator&) = delete;
+
+    ~TFValueEvaluator() {
+        for (TF_Tensor*& t : inputTensors) {
+            if (t) TF_DeleteTensor(t);
+            t = nullptr;
+        }
+        ReleaseModel();
+    }
+
+    bool LoadModel(const char* exportDir,
+                   const char* inputName = "serving_default_dense_input",
+                   const char* outputName = "StatefulPartitionedCall") {
+        if (session) return true;
+
+        status = TF_NewStatus();
+        graph = TF_NewGraph();
+
+        TF_SessionOptions* opts = TF_NewSessionOptions();
+        const char* tags = "serve";
+        session = TF_LoadSessionFromSavedModel(opts, nullptr, exportDir, &tags, 1,
+                                               graph, nullptr, status);
+        TF_DeleteSessionOptions(opts);
+
+        if (TF_GetCode(status) != TF_OK) {
+            std::cerr << "TFValueEvaluator: failed to load " << exportDir << ": " << TF_Message(status) << "\n";
+            ReleaseModel();
+            return false;
+        }
+
+        // Resolve operations once; ScoreBatch never looks names up again
+        input = {TF_GraphOperationByName(graph, inputName), 0};
+        output = {TF_GraphOperationByName(graph, outputName), 0};
+        if (!input.oper || !output.oper) {
+            std::cerr << "TFValueEvaluator: operation '" << (input.oper ? outputName : inputName)
+                      << "' not found in graph\n";
+            ReleaseModel();
+            return false;
+        }
+        return true;
+    }
+
+    bool IsLoaded() const { return session != nullptr; }
+
+    void ScoreBatch(const Candidate* candidates, int count, double* scores) {
+        if (!session || count <= 0 || !Run(candidates, count, scores)) {
+            LinearEvaluator{fallback}.ScoreBatch(candidates, count, scores);
+        }
+    }
+
+    // One session call per candidate; kept for benchmarking the batched path
+    void ScoreEach(const Candidate* candidates, int count, double* scores) {
+        for (int i = 0; i < count; ++i) ScoreBatch(candidates + i, 1, scores + i);
+    }
+
+private:
+    // Frees session, graph and status so a later LoadModel starts from scratch
+    void ReleaseModel() {
+        if (session) {
+            TF_CloseSession(session, status);
+            TF_DeleteSession(session, status);
+            session = nullptr;
+        }
+        if (graph) TF_DeleteGraph(graph);
+        if (status) TF_DeleteStatus(status);
+        graph = nullptr;
+        status = nullptr;
+    }
+
+    // Input tensors are allocated once per batch size and refilled in place
+    TF_Tensor* InputTensor(int count) {
+        TF_Tensor*& t = inputTensors[count];
+        if (!t) {
+            int64_t dims[2] = {count, FEATURE_COUNT};
+            t = TF_AllocateTensor(TF_FLOAT, dims, 2, sizeof(float) * count * FEATURE_COUNT);
+        }
+        return t;
+    }
+
+    bool Run(const Candidate* candidates, int count, double* scores) {
+        TF_Tensor* in = InputTensor(count);
+        float* data = static_cast<float*>(TF_TensorData(in));
+        for (int i = 0; i < count; ++i) {
+            std::copy(candidates[i].features, candidates[i].features + FEATURE_COUNT, data + i * FEATURE_COUNT);
+        }
+
+        TF_Tensor* out = nullptr;
+        TF_SessionRun(session, nullptr,
+                      &input, &in, 1,
+                      &output, &out, 1,
+                      nullptr, 0, nullptr, status);
+        if (TF_GetCode(status) != TF_OK || !out) {
+            if (!reportedFailure) {
+                std::cerr << "TFValueEvaluator: inference failed: " << TF_Message(status) << "\n";
+                reportedFailure = true;
+            }
+            if (out) TF_DeleteTensor(out);
+            return false;
+        }
+
+        bool ok = TF_TensorType(out) == TF_FLOAT &&
+                  TF_TensorByteSize(out) >= sizeof(float) * static_cast<size_t>(count);
+        if (ok) {
+            const float* values = static_cast<const float*>(TF_TensorData(out));
+            for (int i = 0; i < count; ++i) scores[i] = values[i];
+        }
+        TF_DeleteTensor(out);
+        return ok;
+    }
+
+    TF_Graph* graph = nullptr;
+    TF_Session* session = nullptr;
+    TF_Status* status = nullptr;
+    TF_Output input{nullptr, 0};
+    TF_Output output{nullptr, 0};
+    TF_Tensor* inputTensors[MAX_CANDIDATES + 1] = {};
+    bool reportedFailure = false;
+};
+
+} // namespace TetrisEngine
+
+#endif // TETRIS_TF_EVALUATOR_H
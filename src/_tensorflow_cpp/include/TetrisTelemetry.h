@@ -0,0 +1,122 @@
+#ifndef TETRIS_TELEMETRY_H
+#define TETRIS_TELEMETRY_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace TetrisEngine {
+
+// --- Per-generation training metrics ---
+struct GenerationMetrics {
+    int generation = 0;
+    double bestFitness = 0.0;
+    double meanFitness = 0.0;
+    double stddevFitness = 0.0;
+    uint64_t gamesSimulated = 0;
+    uint64_t placementsEvaluated = 0;
+    uint64_t gamesSaved = 0;        // games skipped by the surrogate pre-screen
+    double gamesPerSec = 0.0;
+    double placementsPerSec = 0.0;
+    double workerUtilization = 0.0; // busy time / (wall time * workers)
+    int workers = 1;
+    double generationSec = 0.0;
+    double elapsedSec = 0.0;
+
+    std::string ToJson() const {
+        std::ostringstream out;
+        out.precision(6);
+        out << std::fixed
+            << "{\"generation\":" << generation
+            << ",\"best_fitness\":" << bestFitness
+            << ",\"mean_fitness\":" << meanFitness
+            << ",\"stddev_fitness\":" << stddevFitness
+            << ",\"games_simulated\":" << gamesSimulated
+            << ",\"placements_evaluated\":" << placementsEvaluated
+            << ",\"games_saved\":" << gamesSaved
+            << ",\"games_per_sec\":" << gamesPerSec
+            << ",\"placements_per_sec\":" << placementsPerSec
+            << ",\"worker_utilization\":" << workerUtilization
+            << ",\"workers\":" << workers
+            << ",\"generation_sec\":" << generationSec
+            << ",\"elapsed_sec\":" << elapsedSec
+            << "}";
+        return out.str();
+    }
+};
+
+// --- JSON-lines sink ---
+// Publish() only queues the formatted line; a background thread owns the file,
+// so slow disks never stall the training loop.
+class TelemetrySink {
+public:
+    TelemetrySink() = default;
+    TelemetrySink(const TelemetrySink&) = delete;
+    TelemetrySink& operator=(const TelemetrySink&) = delete;
+    ~TelemetrySink() { Close(); }
+
+    bool Open(const std::string& path) {
+        file.open(path, std::ios::out | std::ios::app);
+        if (!file.is_open()) return false;
+        stopping = false;
+        writer = std::thread(&TelemetrySink::WriterLoop, this);
+        return true;
+    }
+
+    bool IsOpen() const { return file.is_open(); }
+
+    void Publish(const GenerationMetrics& metrics) {
+        if (!file.is_open()) return;
+        std::string line = metrics.ToJson();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(std::move(line));
+        }
+        ready.notify_one();
+    }
+
+    void Close() {
+        if (!writer.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_one();
+        writer.join();
+        file.close();
+    }
+
+private:
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            ready.wait(lock, [&] { return stopping || !pending.empty(); });
+            std::deque<std::string> batch;
+            batch.swap(pending);
+            bool done = stopping;
+            lock.unlock();
+
+            for (const auto& line : batch) file << line << '\n';
+            file.flush(); // one flush per generation keeps dashboards live
+
+            lock.lock();
+            if (done && pending.empty()) return;
+        }
+    }
+
+    std::ofstream file;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::string> pending;
+    bool stopping = false;
+};
+
+} // namespace TetrisEngine
+
+#endif // TETRIS_TELEMETRY_H
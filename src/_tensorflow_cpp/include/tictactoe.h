@@ -14,19 +14,22 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NN_HAS_AVX2_KERNEL 1
+#endif
 #include "tensorflow/c/c_api.h"
-
-// ----------------------------
-// Move Selection Strategies
-// ----------------------------
-
-enum AIMode {
-    EXPERT      = 0,
-    CREATIVE    = 1,
-    MINIMAX     = 2,
-    RANDOM      = 3,
-    TENSORFLOW  = 4  // ← Placeholder
-};
+#include "SpscRing.h"
+#include "AIMode.h"
 
 // ----------------------------
 // C-Style Export Types
@@ -55,6 +58,11 @@ public:
     TF_Session* session = nullptr;
     TF_Status* status = nullptr;
 
+    // Signature names; use Netron.app on saved_model.pb if the export changes them
+    static constexpr const char* INPUT_NAME  = "serving_default_dense_input";
+    static constexpr const char* OUTPUT_NAME = "StatefulPartitionedCall";
+
+    // Loads the SavedModel and resolves the input/output operations once
     bool LoadModel(const char* export_dir) {
         if (session) return true; // Already loaded
 
@@ -79,6 +87,18 @@ public:
 
         if (TF_GetCode(status) != TF_OK) {
             std::cerr << "❌ Failed to load model: " << TF_Message(status) << "\n";
+            ReleaseModel();
+            return false;
+        }
+
+        input = {TF_GraphOperationByName(graph, INPUT_NAME), 0};
+        output = {TF_GraphOperationByName(graph, OUTPUT_NAME), 0};
+        if (!input.oper || !output.oper) {
+            std::cerr << "❌ Invalid tensor name!\n";
+            std::cerr << "   Input '" << INPUT_NAME << "': " << (input.oper ? "FOUND" : "NOT FOUND") << "\n";
+            std::cerr << "   Output '" << OUTPUT_NAME << "': " << (output.oper ? "FOUND" : "NOT FOUND") << "\n";
+            std::cerr << "💡 Use Netron.app to inspect saved_model.pb and get correct names.\n";
+            ReleaseModel();
             return false;
         }
 
@@ -86,99 +106,101 @@ public:
         return true;
     }
 
+    // Safe to call from several threads once loaded. The input goes into this thread's
+    // preallocated tensor and the output is read where TF_SessionRun put it.
     bool PredictBestMove(const float input_board[9], int& best_move) {
         if (!session) {
             std::cerr << "❌ Session not initialized.\n";
             return false;
         }
 
-        // Input tensor: [1, 9]
-        int64_t input_dims[] = {1, 9};
-        TF_Tensor* input_tensor = TF_AllocateTensor(TF_FLOAT, input_dims, 2, sizeof(float) * 9);
-        float* input_data = static_cast<float*>(TF_TensorData(input_tensor));
-        for (int i = 0; i < 9; ++i) {
-            input_data[i] = input_board[i];
-        }
+        ThreadSlot& slot = threadSlot();
+        std::memcpy(slot.data, input_board, sizeof(float) * 9);
 
-        // Output tensor
-        int64_t output_dims[] = {1, 9};
         TF_Tensor* output_tensor = nullptr;
-
-        const char* input_name = "serving_default_dense_input";   // Adjust if needed
-        const char* output_name = "StatefulPartitionedCall";      // Adjust if needed
-
-        TF_Output inputs[1] = {{TF_GraphOperationByName(graph, input_name), 0}};
-        TF_Output outputs[1] = {{TF_GraphOperationByName(graph, output_name), 0}};
-
-        if (!inputs[0].oper || !outputs[0].oper) {
-            std::cerr << "❌ Invalid tensor name!\n";
-            std::cerr << "   Input '" << input_name << "': " << (inputs[0].oper ? "FOUND" : "NOT FOUND") << "\n";
-            std::cerr << "   Output '" << output_name << "': " << (outputs[0].oper ? "FOUND" : "NOT FOUND") << "\n";
-            std::cerr << "💡 Use Netron.app to inspect saved_model.pb and get correct names.\n";
-            TF_DeleteTensor(input_tensor);
-            return false;
-        }
-
         TF_SessionRun(session,
                       nullptr,
-                      inputs, &input_tensor, 1,
-                      outputs, &output_tensor, 1,
+                      &input, &slot.tensor, 1,
+                      &output, &output_tensor, 1,
                       nullptr, 0,
-                      nullptr, status);
+                      nullptr, slot.status);
 
-        if (TF_GetCode(status) != TF_OK) {
-            std::cerr << "❌ Inference failed: " << TF_Message(status) << "\n";
-            TF_DeleteTensor(input_tensor);
+        if (TF_GetCode(slot.status) != TF_OK) {
+            std::cerr << "❌ Inference failed: " << TF_Message(slot.status) << "\n";
             return false;
         }
+        std::unique_ptr<TF_Tensor, void (*)(TF_Tensor*)> output_owner(output_tensor, TF_DeleteTensor);
+        const float* probs = static_cast<const float*>(TF_TensorData(output_tensor));
 
-        float* probs = static_cast<float*>(TF_TensorData(output_tensor));
-
-        // Find valid moves
-        std::vector<int> validMoves;
-        for (int i = 0; i < 9; ++i) {
-            if (input_board[i] == 0.0f) {
-                validMoves.push_back(i);
-            }
-        }
-
-        if (validMoves.empty()) {
-            TF_DeleteTensor(input_tensor);
-            TF_DeleteTensor(output_tensor);
-            return false;
-        }
-
-        // === SOFTMAX SAMPLING WITH TEMPERATURE ===
+        // === SOFTMAX SAMPLING WITH TEMPERATURE === over the valid moves
         const float temperature = 1.5f; // >1.0 = more random, <1.0 = more greedy
-        std::vector<float> exp_probs;
+        int validMoves[9];
+        float weights[9];
+        int count = 0;
         float sum = 0.0f;
-
-        for (int idx : validMoves) {
-            float p = std::exp(probs[idx] / temperature);
-            exp_probs.push_back(p);
-            sum += p;
+        for (int i = 0; i < 9; ++i) {
+            if (input_board[i] != 0.0f) continue;
+            validMoves[count] = i;
+            weights[count] = std::exp(probs[i] / temperature);
+            sum += weights[count++];
+        }
+        if (count == 0) return false;
+
+        thread_local std::mt19937 rng(std::random_device{}());
+        float r = std::uniform_real_distribution<float>(0.0f, sum)(rng);
+        best_move = validMoves[count - 1];
+        for (int k = 0; k < count; ++k) {
+            if ((r -= weights[k]) < 0.0f) {
+                best_move = validMoves[k];
+                break;
+            }
         }
-
-        // Normalize
-        for (float& p : exp_probs) p /= sum;
-
-        // Sample move
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::discrete_distribution<> dist(exp_probs.begin(), exp_probs.end());
-
-        best_move = validMoves[dist(gen)];
-
-        TF_DeleteTensor(input_tensor);
-        TF_DeleteTensor(output_tensor);
         return true;
     }
 
     ~TensorFlowTicTacToe() {
-        if (session) TF_CloseSession(session, status);
-        if (session) TF_DeleteSession(session, status);
+        ReleaseModel();
+    }
+
+private:
+    TF_Output input{nullptr, 0};
+    TF_Output output{nullptr, 0};
+
+    // Frees session, graph and status so a later LoadModel starts from scratch
+    void ReleaseModel() {
+        if (session) {
+            TF_CloseSession(session, status);
+            TF_DeleteSession(session, status);
+            session = nullptr;
+        }
         if (graph) TF_DeleteGraph(graph);
         if (status) TF_DeleteStatus(status);
+        graph = nullptr;
+        status = nullptr;
+    }
+
+    // A [1, 9] input tensor and a status per thread, allocated on first use. TF_SessionRun
+    // doesn't take ownership of its inputs, so the tensor is refilled and reused.
+    struct ThreadSlot {
+        TF_Tensor* tensor;
+        float* data;
+        TF_Status* status;
+
+        ThreadSlot() {
+            int64_t dims[] = {1, 9};
+            tensor = TF_AllocateTensor(TF_FLOAT, dims, 2, sizeof(float) * 9);
+            data = static_cast<float*>(TF_TensorData(tensor));
+            status = TF_NewStatus();
+        }
+        ~ThreadSlot() {
+            TF_DeleteTensor(tensor);
+            TF_DeleteStatus(status);
+        }
+    };
+
+    static ThreadSlot& threadSlot() {
+        thread_local ThreadSlot slot;
+        return slot;
     }
 };
 
@@ -237,191 +259,732 @@ public:
     }
 };
 
+// ----------------------------
+// Game Logic: Bitboard State
+// ----------------------------
+
+// Masks (bit i = cell i) that contain a completed line, in the order isGameOver checks them
+constexpr uint16_t TTT_LINES[8] = {
+    0007, 0070, 0700,   // rows
+    0111, 0222, 0444,   // cols
+    0421, 0124          // diagonals
+};
+
+// 512-entry lookups, built at compile time: line present / base-3 value of a mask
+constexpr std::array<bool, 512> TTT_WIN_TABLE = [] {
+    std::array<bool, 512> t{};
+    for (int m = 0; m < 512; ++m)
+        for (uint16_t line : TTT_LINES)
+            if ((m & line) == line) t[m] = true;
+    return t;
+}();
+
+constexpr std::array<uint16_t, 512> TTT_BASE3_TABLE = [] {
+    std::array<uint16_t, 512> t{};
+    for (int m = 0; m < 512; ++m) {
+        int value = 0;
+        for (int i = 8; i >= 0; --i) value = value * 3 + ((m >> i) & 1);
+        t[m] = static_cast<uint16_t>(value);
+    }
+    return t;
+}();
+
+// Same game as TicTacToe in two 9-bit masks: no heap, win test is one table lookup
+struct TicTacToeBits {
+    uint16_t x = 0; // cells of player 1
+    uint16_t o = 0; // cells of player -1
+
+    void reset() { x = o = 0; }
+
+    uint16_t emptyMask() const { return static_cast<uint16_t>(~(x | o) & 0x1FF); }
+
+    bool isEmpty(int cell) const { return (emptyMask() >> cell) & 1; }
+
+    int at(int cell) const { return ((x >> cell) & 1) ? 1 : ((o >> cell) & 1) ? -1 : 0; }
+
+    void play(int cell, int player) {
+        if (player == 1) x |= static_cast<uint16_t>(1u << cell);
+        else             o |= static_cast<uint16_t>(1u << cell);
+    }
+
+    // Same results as TicTacToe::isGameOver for boards reachable in play
+    bool isGameOver(int& winner) const {
+        winner = TTT_WIN_TABLE[x] ? 1 : TTT_WIN_TABLE[o] ? -1 : 0;
+        return winner != 0 || emptyMask() == 0;
+    }
+
+    // Writes the empty cells in ascending order; returns how many
+    int validMoves(int* out) const {
+        int n = 0;
+        for (uint16_t m = emptyMask(); m; m &= m - 1) out[n++] = lowestCell(m);
+        return n;
+    }
+
+    // Base-3 code used by the minimax table (0 empty, 1 X, 2 O; cell i weighs 3^i)
+    int code() const { return TTT_BASE3_TABLE[x] + 2 * TTT_BASE3_TABLE[o]; }
+
+    // --- Adapters to the int-per-cell layout (TicTacToe::board, TicTacToeResultOnline) ---
+    void toArray(int* cells) const {
+        for (int i = 0; i < 9; ++i) cells[i] = at(i);
+    }
+
+    static TicTacToeBits fromArray(const int* cells) {
+        TicTacToeBits b;
+        for (int i = 0; i < 9; ++i) {
+            if (cells[i] == 1) b.x |= static_cast<uint16_t>(1u << i);
+            else if (cells[i] == -1) b.o |= static_cast<uint16_t>(1u << i);
+        }
+        return b;
+    }
+
+    static int lowestCell(uint16_t mask) {
+        int cell = 0;
+        while (!((mask >> cell) & 1)) ++cell;
+        return cell;
+    }
+};
+
+// ----------------------------
+// SIMD Kernels
+// ----------------------------
+
+// Kernels take the real element count n. Buffers are padded to NN_VECTOR_BYTES, so the SIMD
+// versions round n up to whole vectors, and allocated on whole cache lines (NN_ALIGN_BYTES)
+// so no two buffers share one. On x86 the float/double overloads check the CPU once and use
+// the AVX2/FMA kernels when it has them (no -mavx2 -mfma needed); otherwise, and on other
+// targets, the scalar templates below are used.
+constexpr size_t NN_VECTOR_BYTES = 32;
+constexpr size_t NN_ALIGN_BYTES = 64;
+
+template <typename T>
+struct AlignedAllocator {
+    using value_type = T;
+    AlignedAllocator() = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U>&) {}
+    T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(NN_ALIGN_BYTES))); }
+    void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t(NN_ALIGN_BYTES)); }
+    template <typename U> bool operator==(const AlignedAllocator<U>&) const { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U>&) const { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+template <typename T>
+constexpr int nnLanes() { return static_cast<int>(NN_VECTOR_BYTES / sizeof(T)); }
+
+inline int nnPadded(int n, int lanes) { return (n + lanes - 1) / lanes * lanes; }
+
+// exp() argument limit of the sigmoid (the float limit keeps exp finite)
+template <typename T> constexpr T nnSigmoidLimit() { return sizeof(T) == 4 ? T(80) : T(700); }
+
+template <typename T>
+inline T nnDot(const T* a, const T* b, int n) {
+    T sum = 0;
+    for (int i = 0; i < n; ++i) sum += a[i] * b[i];
+    return sum;
+}
+
+// y += alpha * x
+template <typename T>
+inline void nnAxpy(T alpha, const T* x, T* y, int n) {
+    for (int i = 0; i < n; ++i) y[i] += alpha * x[i];
+}
+
+// acc += sum over r of coeff[r] * row(index ? index[r] : r), rows 'stride' apart
+template <typename T>
+inline void nnAccumulateRows(const T* rows, int stride, const int* index, const T* coeff, int count, T* acc, int n) {
+    for (int r = 0; r < count; ++r) nnAxpy(coeff[r], rows + (index ? index[r] : r) * stride, acc, n);
+}
+
+template <typename T>
+inline void nnSigmoid(const T* x, T* y, int n) {
+    const T limit = nnSigmoidLimit<T>();
+    for (int i = 0; i < n; ++i) y[i] = T(1) / (T(1) + std::exp(-std::max(-limit, std::min(limit, x[i]))));
+}
+
+#ifdef NN_HAS_AVX2_KERNEL
+
+#define NN_AVX2 __attribute__((target("avx2,fma")))
+
+inline bool nnHasAvx2() {
+#if defined(__AVX2__) && defined(__FMA__)
+    return true; // built for AVX2: lets the kernels inline into their callers
+#else
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+#endif
+}
+
+NN_AVX2 inline double nnSum(__m256d v) {
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+NN_AVX2 inline float nnSum(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehdup_ps(s)));
+}
+
+NN_AVX2 inline __m256d nnLoad(const double* p) { return _mm256_load_pd(p); }
+NN_AVX2 inline __m256 nnLoad(const float* p) { return _mm256_load_ps(p); }
+
+// c * x + s
+NN_AVX2 inline __m256d nnFma(double c, __m256d x, __m256d s) { return _mm256_fmadd_pd(_mm256_set1_pd(c), x, s); }
+NN_AVX2 inline __m256 nnFma(float c, __m256 x, __m256 s) { return _mm256_fmadd_ps(_mm256_set1_ps(c), x, s); }
+
+// e^x = 2^n * e^r with |r| <= ln2/2; Taylor series for e^r (degree 10: ~1e-13 relative)
+NN_AVX2 inline __m256d nnExp(__m256d x) {
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0); // 1.5 * 2^52: rounds to integer bits
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(0.6931471805599453), x);
+    __m256d p = _mm256_set1_pd(1.0 / 3628800);
+    const double c[] = {1.0 / 362880, 1.0 / 40320, 1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6, 0.5, 1.0, 1.0};
+#pragma GCC unroll 10
+    for (double ci : c) p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(ci));
+    __m256i ni = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(n, magic)), _mm256_castpd_si256(magic));
+    __m256i scale = _mm256_slli_epi64(_mm256_add_epi64(ni, _mm256_set1_epi64x(1023)), 52);
+    return _mm256_mul_pd(p, _mm256_castsi256_pd(scale));
+}
+
+// Same for float (degree 6: ~1e-7 relative)
+NN_AVX2 inline __m256 nnExp(__m256 x) {
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504f)),
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), r);
+    __m256 p = _mm256_set1_ps(1.0f / 720);
+    const float c[] = {1.0f / 120, 1.0f / 24, 1.0f / 6, 0.5f, 1.0f, 1.0f};
+#pragma GCC unroll 6
+    for (float ci : c) p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(ci));
+    __m256i scale = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(scale));
+}
+
+NN_AVX2 inline double nnDotAvx2(const double* a, const double* b, int n) {
+    __m256d acc = _mm256_setzero_pd();
+#pragma GCC unroll 4
+    for (int i = 0; i < n; i += 4) acc = _mm256_fmadd_pd(_mm256_load_pd(a + i), _mm256_load_pd(b + i), acc);
+    return nnSum(acc);
+}
+
+NN_AVX2 inline float nnDotAvx2(const float* a, const float* b, int n) {
+    __m256 acc = _mm256_setzero_ps();
+#pragma GCC unroll 4
+    for (int i = 0; i < n; i += 8) acc = _mm256_fmadd_ps(_mm256_load_ps(a + i), _mm256_load_ps(b + i), acc);
+    return nnSum(acc);
+}
+
+NN_AVX2 inline void nnAxpyAvx2(double alpha, const double* x, double* y, int n) {
+    __m256d a = _mm256_set1_pd(alpha);
+#pragma GCC unroll 4
+    for (int i = 0; i < n; i += 4) _mm256_store_pd(y + i, _mm256_fmadd_pd(a, _mm256_load_pd(x + i), _mm256_load_pd(y + i)));
+}
+
+NN_AVX2 inline void nnAxpyAvx2(float alpha, const float* x, float* y, int n) {
+    __m256 a = _mm256_set1_ps(alpha);
+#pragma GCC unroll 4
+    for (int i = 0; i < n; i += 8) _mm256_store_ps(y + i, _mm256_fmadd_ps(a, _mm256_load_ps(x + i), _mm256_load_ps(y + i)));
+}
+
+// V vectors of 'acc' stay in registers while the rows stream past
+template <int V, typename T>
+NN_AVX2 inline void nnAccumulateBlock(const T* rows, int stride, const int* index, const T* coeff, int count, T* acc) {
+    using Vec = decltype(nnLoad(acc));
+    constexpr int lanes = static_cast<int>(sizeof(Vec) / sizeof(T));
+    Vec sum[V];
+#pragma GCC unroll 4
+    for (int v = 0; v < V; ++v) sum[v] = nnLoad(acc + v * lanes);
+    for (int r = 0; r < count; ++r) {
+        const T* row = rows + (index ? index[r] : r) * stride;
+        T c = coeff[r];
+#pragma GCC unroll 4
+        for (int v = 0; v < V; ++v) sum[v] = nnFma(c, nnLoad(row + v * lanes), sum[v]);
+    }
+#pragma GCC unroll 4
+    for (int v = 0; v < V; ++v) std::memcpy(acc + v * lanes, &sum[v], sizeof(Vec));
+}
+
+template <typename T>
+NN_AVX2 inline void nnAccumulateRowsAvx2(const T* rows, int stride, const int* index, const T* coeff, int count, T* acc,
+                                         int n) {
+    constexpr int lanes = nnLanes<T>();
+    for (int block = 0; block < n; block += 4 * lanes) {
+        switch (std::min(4, (n - block + lanes - 1) / lanes)) {
+            case 1:  nnAccumulateBlock<1>(rows + block, stride, index, coeff, count, acc + block); break;
+            case 2:  nnAccumulateBlock<2>(rows + block, stride, index, coeff, count, acc + block); break;
+            case 3:  nnAccumulateBlock<3>(rows + block, stride, index, coeff, count, acc + block); break;
+            default: nnAccumulateBlock<4>(rows + block, stride, index, coeff, count, acc + block); break;
+        }
+    }
+}
+
+NN_AVX2 inline void nnSigmoidAvx2(const double* x, double* y, int n) {
+    const __m256d one = _mm256_set1_pd(1.0), limit = _mm256_set1_pd(nnSigmoidLimit<double>());
+    for (int i = 0; i < n; i += 4) {
+        __m256d v = _mm256_max_pd(_mm256_sub_pd(_mm256_setzero_pd(), limit), _mm256_min_pd(limit, _mm256_load_pd(x + i)));
+        _mm256_store_pd(y + i, _mm256_div_pd(one, _mm256_add_pd(one, nnExp(_mm256_sub_pd(_mm256_setzero_pd(), v)))));
+    }
+}
+
+NN_AVX2 inline void nnSigmoidAvx2(const float* x, float* y, int n) {
+    const __m256 one = _mm256_set1_ps(1.0f), limit = _mm256_set1_ps(nnSigmoidLimit<float>());
+    for (int i = 0; i < n; i += 8) {
+        __m256 v = _mm256_max_ps(_mm256_sub_ps(_mm256_setzero_ps(), limit), _mm256_min_ps(limit, _mm256_load_ps(x + i)));
+        _mm256_store_ps(y + i, _mm256_div_ps(one, _mm256_add_ps(one, nnExp(_mm256_sub_ps(_mm256_setzero_ps(), v)))));
+    }
+}
+
+// Runtime dispatch: these non-template overloads win over the scalar templates
+inline double nnDot(const double* a, const double* b, int n) {
+    return nnHasAvx2() ? nnDotAvx2(a, b, n) : nnDot<double>(a, b, n);
+}
+
+inline float nnDot(const float* a, const float* b, int n) {
+    return nnHasAvx2() ? nnDotAvx2(a, b, n) : nnDot<float>(a, b, n);
+}
+
+inline void nnAxpy(double alpha, const double* x, double* y, int n) {
+    if (nnHasAvx2()) nnAxpyAvx2(alpha, x, y, n);
+    else nnAxpy<double>(alpha, x, y, n);
+}
+
+inline void nnAxpy(float alpha, const float* x, float* y, int n) {
+    if (nnHasAvx2()) nnAxpyAvx2(alpha, x, y, n);
+    else nnAxpy<float>(alpha, x, y, n);
+}
+
+inline void nnAccumulateRows(const double* rows, int stride, const int* index, const double* coeff, int count,
+                             double* acc, int n) {
+    if (nnHasAvx2()) nnAccumulateRowsAvx2(rows, stride, index, coeff, count, acc, n);
+    else nnAccumulateRows<double>(rows, stride, index, coeff, count, acc, n);
+}
+
+inline void nnAccumulateRows(const float* rows, int stride, const int* index, const float* coeff, int count,
+                             float* acc, int n) {
+    if (nnHasAvx2()) nnAccumulateRowsAvx2(rows, stride, index, coeff, count, acc, n);
+    else nnAccumulateRows<float>(rows, stride, index, coeff, count, acc, n);
+}
+
+inline void nnSigmoid(const double* x, double* y, int n) {
+    if (nnHasAvx2()) nnSigmoidAvx2(x, y, n);
+    else nnSigmoid<double>(x, y, n);
+}
+
+inline void nnSigmoid(const float* x, float* y, int n) {
+    if (nnHasAvx2()) nnSigmoidAvx2(x, y, n);
+    else nnSigmoid<float>(x, y, n);
+}
+
+#endif
+
 // ----------------------------
 // Neural Network Stub
 // ----------------------------
 
-// Random number generator
-std::random_device rd;
-std::mt19937 gen(rd());
+// Random number generator (one per thread: games run concurrently)
+thread_local std::mt19937 gen(std::random_device{}());
 std::uniform_real_distribution<> dis(0.0, 1.0);
 std::uniform_int_distribution<>  moveDis(0, 8);
 
-class NeuralNetwork {
+// Samples for NeuralNetworkT::trainBatch: 'count' rows of inputs [count][inputSize] and
+// targets [count][outputSize], row-major. A row's weight multiplies its gradient, so a row
+// of weight w moves the weights like w backprops of that sample.
+struct TrainingBatch {
+    int inputSize, outputSize, capacity;
+    int count = 0;
+    std::vector<double> inputs, targets, weights;
+
+    TrainingBatch(int inputSize, int outputSize, int capacity)
+        : inputSize(inputSize), outputSize(outputSize), capacity(std::max(1, capacity)),
+          inputs(static_cast<size_t>(this->capacity) * inputSize),
+          targets(static_cast<size_t>(this->capacity) * outputSize),
+          weights(this->capacity) {}
+
+    bool full() const { return count == capacity; }
+    void clear() { count = 0; }
+
+    void add(const std::vector<double>& input, const std::vector<double>& target, double weight = 1.0) {
+        std::copy_n(input.begin(), inputSize, inputs.begin() + static_cast<size_t>(count) * inputSize);
+        std::copy_n(target.begin(), outputSize, targets.begin() + static_cast<size_t>(count) * outputSize);
+        weights[count] = weight;
+        count++;
+    }
+};
+
+// One hidden layer, sigmoid activations. T is the storage/compute type (float or double);
+// inputs, targets and 'output' stay double so callers don't depend on it.
+//
+// weights_ih is stored input-major (one contiguous row of hidden weights per input) so the
+// hidden layer is a sum of rows over the non-zero inputs; a board is mostly empty cells.
+// weights_ho is output-major. Rows are padded with zeros to whole SIMD vectors.
+template <typename T>
+class NeuralNetworkT {
 public:
- 
-    std::vector<double> input, hidden, output;
-    std::vector<std::vector<double>> weights_ih, weights_ho;
-    std::vector<double> bias_h, bias_o;
+
+    std::vector<double> output;
+    AlignedVector<T> weights_ih, weights_ho;    // [input][hidden], [output][hidden]
+    AlignedVector<T> bias_h, bias_o;
     double learningRate = 0.1;
 
-    NeuralNetwork(int inputSize, int hiddenSize, int outputSize)
-        : input(inputSize), hidden(hiddenSize), output(outputSize),
-          weights_ih(hiddenSize, std::vector<double>(inputSize)),
-          weights_ho(outputSize, std::vector<double>(hiddenSize)),
-          bias_h(hiddenSize), bias_o(outputSize) {
+    NeuralNetworkT(int inputSize, int hiddenSize, int outputSize) {
+        resize(inputSize, hiddenSize, outputSize);
 
-        // Initialize weights and biases randomly
-        for (auto& row : weights_ih)
-            for (double& w : row)
-                w = dis(gen) * 2.0 - 1.0;
+        // Initialize weights and biases randomly (same draw order as the nested-vector version)
+        for (int i = 0; i < nHidden; ++i)
+            for (int j = 0; j < nIn; ++j)
+                weights_ih[j * hidStride + i] = static_cast<T>(dis(gen) * 2.0 - 1.0);
 
-        for (auto& row : weights_ho)
-            for (double& w : row)
-                w = dis(gen) * 2.0 - 1.0;
+        for (int i = 0; i < nOut; ++i)
+            for (int j = 0; j < nHidden; ++j)
+                weights_ho[i * hidStride + j] = static_cast<T>(dis(gen) * 2.0 - 1.0);
 
-        for (double& b : bias_h)
-            b = dis(gen) * 2.0 - 1.0;
+        for (int i = 0; i < nHidden; ++i)
+            bias_h[i] = static_cast<T>(dis(gen) * 2.0 - 1.0);
 
-        for (double& b : bias_o)
-            b = dis(gen) * 2.0 - 1.0;
+        for (int i = 0; i < nOut; ++i)
+            bias_o[i] = static_cast<T>(dis(gen) * 2.0 - 1.0);
     }
 
-	// Sigmoid function
-	double sigmoid(double x) {
-	    return 1.0 / (1.0 + exp(-std::max(-700.0, std::min(700.0, x))));
-	}
-	
-	// Derivative of sigmoid
-	double sigmoidDerivative(double x) {
-	    double s = sigmoid(x);
-	    return s * (1 - s);
-	}
+    int inputSize() const { return nIn; }
+    int hiddenSize() const { return nHidden; }
+    int outputSize() const { return nOut; }
+
+    // Hogwild: forward/backprop/trainBatch read and update owner's weights in place, without
+    // locks, while this network keeps its own scratch. Several such networks on different
+    // threads race on the weights (plain loads and stores; an update can be lost or read half
+    // applied, which SGD tolerates). Copies share too; saveModel() writes the owner's weights and
+    // loadModel() detaches. The view keeps owner alive; owner must not be moved from while
+    // views use it. A view's own weight vectors are empty.
+    void shareWeights(std::shared_ptr<NeuralNetworkT> owner) {
+        if (owner->shared) owner = owner->shared;
+        if (owner.get() == this) return;
+        resize(owner->nIn, owner->nHidden, owner->nOut);
+        AlignedVector<T>().swap(weights_ih);
+        AlignedVector<T>().swap(weights_ho);
+        AlignedVector<T>().swap(bias_h);
+        AlignedVector<T>().swap(bias_o);
+        shared = std::move(owner);
+    }
+
+    bool sharesWeights() const { return shared != nullptr; }
 
     void forward(const std::vector<double>& x) {
-        input = x;
-        for (int i = 0; i < hidden.size(); ++i) {
-            double activation = bias_h[i];
-            for (int j = 0; j < input.size(); ++j) {
-                activation += weights_ih[i][j] * input[j];
-            }
-            hidden[i] = sigmoid(activation);
+        NeuralNetworkT& params = weightOwner();
+        activeCount = 0;
+        for (int j = 0; j < nIn; ++j) {  // branch-free: board cells are unpredictable
+            input[j] = static_cast<T>(x[j]);
+            activeInput[activeCount] = input[j];
+            active[activeCount] = j;
+            activeCount += input[j] != T(0);
         }
 
-        for (int i = 0; i < output.size(); ++i) {
-            double activation = bias_o[i];
-            for (int j = 0; j < hidden.size(); ++j) {
-                activation += weights_ho[i][j] * hidden[j];
-            }
-            output[i] = sigmoid(activation);
-        }
+        std::copy(params.bias_h.begin(), params.bias_h.end(), activation.begin());
+        nnAccumulateRows(params.weights_ih.data(), hidStride, active.data(), activeInput.data(), activeCount,
+                         activation.data(), nHidden);
+        nnSigmoid(activation.data(), hidden.data(), nHidden);
+        std::fill(hidden.begin() + nHidden, hidden.end(), T(0)); // padding must not feed weight updates
+
+        for (int i = 0; i < nOut; ++i)
+            activation[i] = params.bias_o[i] + nnDot(&params.weights_ho[i * hidStride], hidden.data(), nHidden);
+        nnSigmoid(activation.data(), out.data(), nOut);
+        for (int i = 0; i < nOut; ++i) output[i] = static_cast<double>(out[i]);
+        slopesReady = false;
     }
 
+    // The derivative is taken as s(a) * (1 - s(a)) of the stored activations, as it always was.
+    // It only depends on the last forward(), so repeated backprops reuse it.
     void backprop(const std::vector<double>& target) {
-        std::vector<double> outputError(output.size());
-        std::vector<double> hiddenError(hidden.size());
+        NeuralNetworkT& params = weightOwner();
+        const T lr = static_cast<T>(learningRate);
+        if (!slopesReady) {
+            nnSigmoid(out.data(), slopeOut.data(), nOut);
+            nnSigmoid(hidden.data(), slopeHidden.data(), nHidden);
+            for (int i = 0; i < nOut; ++i) slopeOut[i] *= T(1) - slopeOut[i];
+            for (int j = 0; j < nHidden; ++j) slopeHidden[j] *= T(1) - slopeHidden[j];
+            slopesReady = true;
+        }
 
         // Output layer gradients
-        std::vector<double> grad_output(output.size());
-        for (int i = 0; i < output.size(); ++i) {
-            double error = target[i] - output[i];
-            grad_output[i] = error * sigmoidDerivative(output[i]);
+        for (int i = 0; i < nOut; ++i)
+            gradOut[i] = (static_cast<T>(target[i]) - out[i]) * slopeOut[i];
+
+        // Hidden layer gradients (weights_ho^T * gradOut), before any weight moves
+        std::fill(gradHidden.begin(), gradHidden.end(), T(0));
+        nnAccumulateRows(params.weights_ho.data(), hidStride, nullptr, gradOut.data(), nOut, gradHidden.data(), nHidden);
+        for (int j = 0; j < nHidden; ++j) gradHidden[j] *= slopeHidden[j];
+
+        // Update weights and biases (output layer)
+        for (int i = 0; i < nOut; ++i) {
+            params.bias_o[i] += lr * gradOut[i];
+            nnAxpy(lr * gradOut[i], hidden.data(), &params.weights_ho[i * hidStride], nHidden);
         }
 
-        // Hidden layer gradients
-        std::vector<double> grad_hidden(hidden.size(), 0);
-        for (int i = 0; i < hidden.size(); ++i) {
-            for (int j = 0; j < output.size(); ++j) {
-                grad_hidden[i] += grad_output[j] * weights_ho[j][i];
+        // Update weights and biases (hidden layer); rows of zero inputs don't move
+        for (int j = 0; j < nHidden; ++j) params.bias_h[j] += lr * gradHidden[j];
+        for (int a = 0; a < activeCount; ++a)
+            nnAxpy(lr * input[active[a]], gradHidden.data(), &params.weights_ih[active[a] * hidStride], nHidden);
+    }
+
+    // Mini-batch update: forward and backward run over the whole batch as small matrix products
+    // (one row per sample) and the gradient, averaged over the batch, is applied once. Same
+    // derivative as backprop(); a batch of one is the same update as forward() + backprop().
+    // 'weights' (null: all 1) scale each row's gradient; the average is over the rows, so a
+    // batch of one row of weight w is the step of w backprops from the same forward().
+    // The last forward()'s state is left alone.
+    void trainBatch(const TrainingBatch& batch) {
+        trainBatch(batch.inputs.data(), batch.targets.data(), batch.weights.data(), batch.count);
+    }
+
+    void trainBatch(const double* inputs, const double* targets, const double* weights, int count) {
+        NeuralNetworkT& params = weightOwner();
+        if (count <= 0) return;
+        reserveBatch(count);
+        const int outStride = nnPadded(nOut, nnLanes<T>());
+        const int cap = batchCapacity;
+        const T step = static_cast<T>(learningRate / count);
+
+        // H = sigmoid(X * weights_ih + bias_h), per row over its non-zero inputs; the non-zero
+        // entries of each input column are kept for X^T * gradHidden below
+        std::fill(colCount.begin(), colCount.end(), 0);
+        for (int b = 0; b < count; ++b) {
+            const double* x = inputs + static_cast<size_t>(b) * nIn;
+            int n = 0;
+            for (int j = 0; j < nIn; ++j) {
+                T v = static_cast<T>(x[j]);
+                rowActive[n] = j;
+                rowActiveInput[n] = v;
+                n += v != T(0);
+                colIndex[j * cap + colCount[j]] = b;
+                colCoeff[j * cap + colCount[j]] = v;
+                colCount[j] += v != T(0);
             }
-            grad_hidden[i] *= sigmoidDerivative(hidden[i]);
+            T* a = &batchHidden[b * hidStride];
+            std::copy(params.bias_h.begin(), params.bias_h.end(), a);
+            std::fill(a + nHidden, a + hidStride, T(0));
+            nnAccumulateRows(params.weights_ih.data(), hidStride, rowActive.data(), rowActiveInput.data(), n, a, nHidden);
         }
-
-        // Update weights and biases (output layer)
-        for (int i = 0; i < output.size(); ++i) {
-            bias_o[i] += learningRate * grad_output[i];
-            for (int j = 0; j < hidden.size(); ++j) {
-                weights_ho[i][j] += learningRate * grad_output[i] * hidden[j];
+        nnSigmoid(batchHidden.data(), batchHidden.data(), count * hidStride);
+        nnSigmoid(batchHidden.data(), batchSlopeHidden.data(), count * hidStride);
+        for (int b = 0; b < count; ++b)
+            std::fill(&batchHidden[b * hidStride + nHidden], &batchHidden[(b + 1) * hidStride], T(0));
+
+        // O = sigmoid(H * weights_ho^T + bias_o)
+        for (int j = 0; j < nHidden; ++j)
+            for (int i = 0; i < nOut; ++i) weightsHoT[j * outStride + i] = params.weights_ho[i * hidStride + j];
+        for (int b = 0; b < count; ++b) {
+            T* a = &batchOut[b * outStride];
+            std::copy(params.bias_o.begin(), params.bias_o.end(), a);
+            std::fill(a + nOut, a + outStride, T(0));
+            nnAccumulateRows(weightsHoT.data(), outStride, nullptr, &batchHidden[b * hidStride], nHidden, a, nOut);
+        }
+        nnSigmoid(batchOut.data(), batchOut.data(), count * outStride);
+        nnSigmoid(batchOut.data(), batchSlopeOut.data(), count * outStride);
+
+        // Output gradients, kept both by sample and by output
+        for (int b = 0; b < count; ++b) {
+            const double* t = targets + static_cast<size_t>(b) * nOut;
+            const T w = weights ? static_cast<T>(weights[b]) : T(1);
+            for (int i = 0; i < nOut; ++i) {
+                T slope = batchSlopeOut[b * outStride + i];
+                T g = w * (static_cast<T>(t[i]) - batchOut[b * outStride + i]) * slope * (T(1) - slope);
+                batchGradOut[b * outStride + i] = g;
+                batchGradOutT[i * cap + b] = g;
             }
         }
 
-        // Update weights and biases (hidden layer)
-        for (int i = 0; i < hidden.size(); ++i) {
-            bias_h[i] += learningRate * grad_hidden[i];
-            for (int j = 0; j < input.size(); ++j) {
-                weights_ih[i][j] += learningRate * grad_hidden[i] * input[j];
+        // gradHidden = (gradOut * weights_ho) .* slope(H), before any weight moves
+        std::fill(batchGradHidden.begin(), batchGradHidden.begin() + count * hidStride, T(0));
+        for (int b = 0; b < count; ++b) {
+            T* g = &batchGradHidden[b * hidStride];
+            nnAccumulateRows(params.weights_ho.data(), hidStride, nullptr, &batchGradOut[b * outStride], nOut, g, nHidden);
+            for (int j = 0; j < nHidden; ++j) {
+                T slope = batchSlopeHidden[b * hidStride + j];
+                g[j] *= slope * (T(1) - slope);
             }
         }
+
+        // Output layer: weights_ho += step * gradOut^T * H
+        for (int i = 0; i < nOut; ++i) {
+            T* w = &params.weights_ho[i * hidStride];
+            const T* g = &batchGradOutT[i * cap];
+            std::fill(gradRow.begin(), gradRow.end(), T(0));
+            nnAccumulateRows(batchHidden.data(), hidStride, nullptr, g, count, gradRow.data(), nHidden);
+            nnAxpy(step, gradRow.data(), w, nHidden);
+            T sum = 0;
+            for (int b = 0; b < count; ++b) sum += g[b];
+            params.bias_o[i] += step * sum;
+        }
+
+        // Hidden layer: weights_ih += step * X^T * gradHidden; rows of inputs that were zero
+        // in every sample don't move
+        for (int j = 0; j < nIn; ++j) {
+            if (colCount[j] == 0) continue;
+            std::fill(gradRow.begin(), gradRow.end(), T(0));
+            nnAccumulateRows(batchGradHidden.data(), hidStride, &colIndex[j * cap], &colCoeff[j * cap], colCount[j],
+                             gradRow.data(), nHidden);
+            nnAxpy(step, gradRow.data(), &params.weights_ih[j * hidStride], nHidden);
+        }
+        std::fill(gradRow.begin(), gradRow.end(), T(0));
+        for (int b = 0; b < count; ++b) nnAxpy(T(1), &batchGradHidden[b * hidStride], gradRow.data(), nHidden);
+        for (int j = 0; j < nHidden; ++j) params.bias_h[j] += step * gradRow[j];
     }
-    
-    //  ADD THE saveModel FUNCTION HERE, INSIDE THE CLASS
+
+    // Text format unchanged: "rows cols" + rows of weights (weights_ih as [hidden][input]),
+    // then "size" + values for each bias
 	bool saveModel(const std::string& filename) {
 	        std::ofstream file(filename);
 	        if (!file.is_open()) {
 	            return false;
 	        }
 	
-	        auto writeMatrix = [&](const std::vector<std::vector<double>>& mat) {
-	            file << mat.size() << " " << mat[0].size() << "\n";
-	            for (const auto& row : mat) {
-	                for (double w : row) {
-	                    file << std::setprecision(10) << w << " ";
+	        auto writeMatrix = [&](int rows, int cols, auto at) {
+	            file << rows << " " << cols << "\n";
+	            for (int i = 0; i < rows; ++i) {
+	                for (int j = 0; j < cols; ++j) {
+	                    file << std::setprecision(10) << at(i, j) << " ";
 	                }
 	                file << "\n";
 	            }
 	        };
 	
-	        auto writeVector = [&](const std::vector<double>& vec) {
+	        auto writeVector = [&](const AlignedVector<T>& vec) {
 	            file << vec.size() << "\n";
-	            for (double v : vec) {
+	            for (T v : vec) {
 	                file << std::setprecision(10) << v << " ";
 	            }
 	            file << "\n";
 	        };
 	
-	        writeMatrix(weights_ih);
-	        writeMatrix(weights_ho);
-	        writeVector(bias_h);
-	        writeVector(bias_o);
+	        const NeuralNetworkT& params = weightOwner();
+	        writeMatrix(nHidden, nIn, [&](int i, int j) { return params.weights_ih[j * hidStride + i]; });
+	        writeMatrix(nOut, nHidden, [&](int i, int j) { return params.weights_ho[i * hidStride + j]; });
+	        writeVector(params.bias_h);
+	        writeVector(params.bias_o);
 	
 	        file.close();
 	        return true;
 	    }
     //
-    // Loads the model from a text file
+    // Loads the model from a text file (the network takes the file's layer sizes)
 	bool loadModel(const std::string& filename) {
 	    std::ifstream file(filename);
 	    if (!file.is_open()) {
 	        return false; // File not found or can't open
 	    }
 	
-	    auto readMatrix = [&](std::vector<std::vector<double>>& mat) -> bool {
-	        int rows, cols;
-	        if (!(file >> rows >> cols)) return false;
-	        mat.resize(rows, std::vector<double>(cols));
-	        for (auto& row : mat) {
-	            for (double& w : row) {
-	                if (!(file >> w)) return false;
-	            }
+	    auto readMatrix = [&](std::vector<T>& mat, int& rows, int& cols) -> bool {
+	        if (!(file >> rows >> cols) || rows <= 0 || cols <= 0) return false;
+	        mat.resize(static_cast<size_t>(rows) * cols);
+	        for (T& w : mat) {
+	            if (!(file >> w)) return false;
 	        }
 	        return true;
 	    };
 	
-	    auto readVector = [&](std::vector<double>& vec) -> bool {
+	    auto readVector = [&](std::vector<T>& vec, int expected) -> bool {
 	        int size;
-	        if (!(file >> size)) return false;
+	        if (!(file >> size) || size != expected) return false;
 	        vec.resize(size);
-	        for (double& v : vec) {
+	        for (T& v : vec) {
 	            if (!(file >> v)) return false;
 	        }
 	        return true;
 	    };
 	
 	    // Read in the same order as saveModel()
-	    if (!readMatrix(weights_ih)) goto fail;
-	    if (!readMatrix(weights_ho)) goto fail;
-	    if (!readVector(bias_h))     goto fail;
-	    if (!readVector(bias_o))     goto fail;
+	    std::vector<T> ih, ho, bh, bo;
+	    int hRows, hCols, oRows, oCols;
+	    if (!readMatrix(ih, hRows, hCols)) return false;
+	    if (!readMatrix(ho, oRows, oCols) || oCols != hRows) return false;
+	    if (!readVector(bh, hRows)) return false;
+	    if (!readVector(bo, oRows)) return false;
 	
-	    file.close();
+	    resize(hCols, hRows, oRows);
+	    for (int i = 0; i < nHidden; ++i)
+	        for (int j = 0; j < nIn; ++j) weights_ih[j * hidStride + i] = ih[i * nIn + j];
+	    for (int i = 0; i < nOut; ++i) std::copy_n(&ho[i * nHidden], nHidden, &weights_ho[i * hidStride]);
+	    std::copy(bh.begin(), bh.end(), bias_h.begin());
+	    std::copy(bo.begin(), bo.end(), bias_o.begin());
 	    return true;
-	
-	fail:
-	    file.close();
-	    return false;
 	}
+
+private:
+    int nIn = 0, nHidden = 0, nOut = 0;
+    int hidStride = 0;
+    std::shared_ptr<NeuralNetworkT> shared; // set by shareWeights()
+
+    NeuralNetworkT& weightOwner() { return shared ? *shared : *this; }
+
+    // Scratch, allocated once: forward/backprop don't touch the heap
+    AlignedVector<T> input, hidden, out, activation, slopeOut, slopeHidden, gradOut, gradHidden;
+    std::vector<int> active;    // indices of non-zero inputs
+    AlignedVector<T> activeInput;
+    int activeCount = 0;
+    bool slopesReady = false;
+
+    // trainBatch scratch, grown to the largest batch seen: [sample][hidden/output] matrices,
+    // output gradients by output, and the non-zero samples of each input column
+    int batchCapacity = 0;
+    AlignedVector<T> batchHidden, batchOut, batchSlopeHidden, batchSlopeOut, batchGradHidden, batchGradOut;
+    AlignedVector<T> batchGradOutT, weightsHoT, gradRow, rowActiveInput, colCoeff;
+    std::vector<int> rowActive, colIndex, colCount;
+
+    void reserveBatch(int count) {
+        if (count <= batchCapacity) return;
+        batchCapacity = count;
+        const int outStride = nnPadded(nOut, nnLanes<T>());
+        const size_t rows = static_cast<size_t>(count);
+        batchHidden.assign(rows * hidStride, T(0));
+        batchSlopeHidden.assign(rows * hidStride, T(0));
+        batchGradHidden.assign(rows * hidStride, T(0));
+        batchOut.assign(rows * outStride, T(0));
+        batchSlopeOut.assign(rows * outStride, T(0));
+        batchGradOut.assign(rows * outStride, T(0));
+        batchGradOutT.assign(rows * nOut, T(0));
+        weightsHoT.assign(static_cast<size_t>(nHidden) * outStride, T(0));
+        gradRow.assign(hidStride, T(0));
+        rowActive.assign(nIn, 0);
+        rowActiveInput.assign(nIn, T(0));
+        colIndex.assign(rows * nIn, 0);
+        colCoeff.assign(rows * nIn, T(0));
+        colCount.assign(nIn, 0);
+    }
+
+    void resize(int inputSize, int hiddenSize, int outputSize) {
+        nIn = inputSize;
+        nHidden = hiddenSize;
+        nOut = outputSize;
+        shared = nullptr;
+        hidStride = nnPadded(nHidden, nnLanes<T>());
+        int outStride = nnPadded(nOut, nnLanes<T>());
+        int widest = std::max(hidStride, outStride);
+
+        weights_ih.assign(static_cast<size_t>(nIn) * hidStride, T(0));
+        weights_ho.assign(static_cast<size_t>(nOut) * hidStride, T(0));
+        bias_h.assign(nHidden, T(0));
+        bias_o.assign(nOut, T(0));
+        output.assign(nOut, 0.0);
+        input.assign(nIn, T(0));
+        active.assign(nIn, 0);
+        activeInput.assign(nIn, T(0));
+        activeCount = 0;
+        hidden.assign(hidStride, T(0));
+        out.assign(outStride, T(0));
+        activation.assign(widest, T(0));
+        slopeOut.assign(outStride, T(0));
+        slopeHidden.assign(hidStride, T(0));
+        gradOut.assign(outStride, T(0));
+        gradHidden.assign(hidStride, T(0));
+        slopesReady = false;
+        batchCapacity = 0;
+    }
 };
 
+using NeuralNetwork = NeuralNetworkT<double>;
+
 //-----------------------------
 // utilities
 //-----------------------------
@@ -452,51 +1015,82 @@ int selectMove(const std::vector<double>& output, const TicTacToe& game) {
     return std::distance(masked.begin(), std::max_element(masked.begin(), masked.end()));
 }
 
-//
-void trainStep(NeuralNetwork& net) { 
-    TicTacToe game;
-    std::vector<std::pair<std::vector<double>, std::vector<double>>> history; // (state, move_prob)
+// selectMove for the bitboard state: first highest output among the empty cells
+int selectMove(const std::vector<double>& output, const TicTacToeBits& game) {
+    int best = -1;
+    for (uint16_t m = game.emptyMask(); m; m &= m - 1) {
+        int cell = TicTacToeBits::lowestCell(m);
+        if (best < 0 || output[cell] > output[best]) best = cell;
+    }
+    return best < 0 ? 0 : best;
+}
+
+// Network input (-1, 0, 1) written into a reused vector
+void boardToInput(const TicTacToeBits& game, std::vector<double>& input) {
+    input.resize(9);
+    for (int i = 0; i < 9; ++i) input[i] = static_cast<double>(game.at(i));
+}
+
+// One greedy self-play game, the network playing both sides. Leaves in input/target the
+// last position and the outcome target for the final move (the network's last forward() is
+// that position) and returns the number of moves played, which trainStep replays it for.
+template <typename T>
+int playTrainingGame(NeuralNetworkT<T>& net, std::vector<double>& input, std::vector<double>& target) {
+    TicTacToeBits game;
+    int plies = 0; // the outcome is replayed once per move played, as with the old (state, move_prob) history
 
     int turn = 1; // 1 = X (network), -1 = O (network too)
     while (true) {
-        std::vector<double> input = boardToInput(game.board);
+        boardToInput(game, input);
         net.forward(input);
 
-        auto validMoves = game.getValidMoves();
-        if (validMoves.empty()) break;
+        if (game.emptyMask() == 0) return plies;
 
         int move = selectMove(net.output, game);
+        plies++;
 
-        // Store state and raw output before masking
-        history.push_back({input, net.output});
-
-        game.board[move] = turn;
+        game.play(move, turn);
 
         int winner;
         if (game.isGameOver(winner)) {
-            // Generate targets based on outcome
-            for (auto& [state, probs] : history) {
-                std::vector<double> target(9, 0.0);
-                if (turn == 1) {
-                    // Last move was winning/drawing
-                    if (winner == 1) target[move] = 1.0;   // win
-                    else if (winner == -1) target[move] = -1.0; // loss
-                    else target[move] = 0.5;             // draw
-                } else {
-                    if (winner == -1) target[move] = 1.0;
-                    else if (winner == 1) target[move] = -1.0;
-                    else target[move] = 0.5;
-                }
-
-                // Simple TD-style update: reinforce final result
-                net.backprop(target);
-            }
-            break;
+            // Generate target based on outcome
+            target.assign(9, 0.0);
+            int mover = (turn == 1) ? winner : -winner;
+            if (mover == 1) target[move] = 1.0;        // last move won
+            else if (mover == -1) target[move] = -1.0; // loss
+            else target[move] = 0.5;                   // draw
+            return plies;
         }
 
         turn = -turn; // switch player
     }
-	
+}
+
+//
+template <typename T>
+void trainStep(NeuralNetworkT<T>& net) { 
+    std::vector<double> input, target;
+    int plies = playTrainingGame(net, input, target);
+
+    // Simple TD-style update: reinforce final result
+    for (int i = 0; i < plies; ++i) net.backprop(target);
+}
+
+// trainStep that collects instead of updating: the same sample, weighted by the moves
+// played, goes into 'batch', which is trained and cleared whenever it fills. Call
+// net.trainBatch(batch) at the end for a partial batch. trainBatch averages over the
+// games in the batch, so net.learningRate times batch.capacity is trainStep's step size.
+template <typename T>
+void trainStep(NeuralNetworkT<T>& net, TrainingBatch& batch) {
+    std::vector<double> input, target;
+    int plies = playTrainingGame(net, input, target);
+    if (plies == 0) return;
+
+    batch.add(input, target, plies);
+    if (batch.full()) {
+        net.trainBatch(batch);
+        batch.clear();
+    }
 }
 
 //
@@ -564,6 +1158,37 @@ int selectRandomMove(TicTacToe& game) {
     return valid[dist(gen)];
 }
 
+// Bitboard versions of the selectors above; same choices (greedy ties go to the higher cell),
+// but they iterate empty bits and draw from the shared 'gen' instead of seeding per call
+int selectGreedy(const std::vector<double>& scores, const TicTacToeBits& game) {
+    int best = -1;
+    for (uint16_t m = game.emptyMask(); m; m &= m - 1) {
+        int cell = TicTacToeBits::lowestCell(m);
+        if (best < 0 || scores[cell] >= scores[best]) best = cell;
+    }
+    return best;
+}
+
+//
+int selectSampled(const std::vector<double>& probs, const TicTacToeBits& game) {
+    int valid[9];
+    int count = game.validMoves(valid);
+    if (count == 0) return -1;
+    double weights[9];
+    for (int i = 0; i < count; ++i) weights[i] = probs[valid[i]];
+    std::discrete_distribution<> dist(weights, weights + count);
+    return valid[dist(gen)];
+}
+
+//
+int selectRandomMove(const TicTacToeBits& game) {
+    int valid[9];
+    int count = game.validMoves(valid);
+    if (count == 0) return -1;
+    std::uniform_int_distribution<> dist(0, count - 1);
+    return valid[dist(gen)];
+}
+
 // ----------------------------
 // Deterministic Minimax AI
 // ----------------------------
@@ -623,7 +1248,8 @@ int minimax(const int board[9], int depth, bool isMaximizing, int alpha = -1000,
     }
 }
 
-int minimaxMove(std::vector<int> board, int player) {
+// Reference search: one full minimax per empty cell (kept for benchmarks and validation)
+int minimaxMoveSearch(std::vector<int> board, int player) {
 
     int bestMove = -1;
     int bestValue = (player == 1) ? -1000 : 1000;
@@ -655,6 +1281,106 @@ int minimaxMove(std::vector<int> board, int player) {
     return bestMove;
 }
 
+// ----------------------------
+// Solved Minimax Table
+// ----------------------------
+
+// Every board (base-3: 0 empty, 1 X, 2 O; cell i weighs 3^i) times the side to move,
+// solved once on first use. 'value' is what minimax(board, 0, player == 1) returns and
+// 'bestMoves' has bit i set for every move minimaxMove would rate best, so a MINIMAX move
+// is one lookup. Both starters are covered because either side may open.
+struct MinimaxEntry {
+    int8_t   value;
+    uint16_t bestMoves;
+};
+
+constexpr int MINIMAX_STATES = 19683; // 3^9
+
+inline int encodeBoard(const int* board) {
+    int code = 0;
+    for (int i = 8; i >= 0; --i) code = code * 3 + (board[i] == 1 ? 1 : board[i] == -1 ? 2 : 0);
+    return code;
+}
+
+inline const std::vector<MinimaxEntry>& minimaxTable() {
+    static const std::vector<MinimaxEntry> table = [] {
+        const int wins[8][3] = {
+            {0,1,2}, {3,4,5}, {6,7,8},
+            {0,3,6}, {1,4,7}, {2,5,8},
+            {0,4,8}, {2,4,6}
+        };
+        int pow3[9];
+        pow3[0] = 1;
+        for (int i = 1; i < 9; ++i) pow3[i] = pow3[i - 1] * 3;
+
+        // index = code * 2 + (player == 1 ? 0 : 1)
+        std::vector<MinimaxEntry> t(MINIMAX_STATES * 2);
+        std::vector<int> byStones[10];
+        for (int code = 0; code < MINIMAX_STATES; ++code) {
+            int stones = 0;
+            for (int i = 0, c = code; i < 9; ++i, c /= 3) stones += c % 3 != 0;
+            byStones[stones].push_back(code);
+        }
+
+        // Children have one more stone, so fill from full boards down to the empty one
+        for (int stones = 9; stones >= 0; --stones) {
+            for (int code : byStones[stones]) {
+                int cell[9];
+                for (int i = 0, c = code; i < 9; ++i, c /= 3) cell[i] = c % 3 == 1 ? 1 : c % 3 == 2 ? -1 : 0;
+
+                int winner = 0;
+                for (const auto& w : wins) {
+                    if (cell[w[0]] != 0 && cell[w[0]] == cell[w[1]] && cell[w[1]] == cell[w[2]]) {
+                        winner = cell[w[0]];
+                        break;
+                    }
+                }
+
+                for (int player : {1, -1}) {
+                    MinimaxEntry& e = t[code * 2 + (player == 1 ? 0 : 1)];
+                    int best = player == 1 ? -1000 : 1000;
+                    int childValue[9];
+                    for (int i = 0; i < 9; ++i) {
+                        if (cell[i] != 0) continue;
+                        int child = code + (player == 1 ? 1 : 2) * pow3[i];
+                        childValue[i] = t[child * 2 + (player == 1 ? 1 : 0)].value;
+                        best = player == 1 ? std::max(best, childValue[i]) : std::min(best, childValue[i]);
+                    }
+                    e.bestMoves = 0;
+                    for (int i = 0; i < 9; ++i)
+                        if (cell[i] == 0 && childValue[i] == best) e.bestMoves |= static_cast<uint16_t>(1u << i);
+
+                    // One ply deeper costs one point: a win d plies ahead scores 10 - d
+                    if (winner != 0)          e.value = static_cast<int8_t>(winner == 1 ? 10 : -10);
+                    else if (stones == 9)     e.value = 0;
+                    else                      e.value = static_cast<int8_t>(best > 0 ? best - 1 : best < 0 ? best + 1 : 0);
+                }
+            }
+        }
+        return t;
+    }();
+    return table;
+}
+
+inline const MinimaxEntry& minimaxLookup(const int* board, int player) {
+    return minimaxTable()[encodeBoard(board) * 2 + (player == 1 ? 0 : 1)];
+}
+
+// Same move as minimaxMoveSearch (lowest index among the best), by table lookup
+int minimaxMove(std::vector<int> board, int player) {
+    uint16_t best = minimaxLookup(board.data(), player).bestMoves;
+    if (best == 0) return -1;
+    int move = 0;
+    while (!(best & (1u << move))) ++move;
+    return move;
+}
+
+//
+int minimaxMove(const TicTacToeBits& game, int player) {
+    uint16_t best = minimaxTable()[game.code() * 2 + (player == 1 ? 0 : 1)].bestMoves;
+    return best == 0 ? -1 : TicTacToeBits::lowestCell(best);
+}
+
 // ----------------------------
 // Main Move Selector
 // ----------------------------
@@ -679,6 +1405,339 @@ int selectMove(const std::vector<double>& output, TicTacToe& game, int aiMode, d
     }
 }
 
+//
+int selectMove(const std::vector<double>& output, const TicTacToeBits& game, int aiMode, double temperature) {
+
+    if (aiMode == MINIMAX || aiMode == TENSORFLOW) {
+        return -1;
+    }
+
+    auto probs = softmax(output, temperature);
+
+    switch (aiMode) {
+        case RANDOM:
+	        return selectRandomMove(game);
+        case CREATIVE:
+            return selectSampled(probs, game);
+        default:
+            return selectGreedy(probs, game);
+    }
+}
+
+// ----------------------------
+// Parallel Training
+// ----------------------------
+
+// Actor/learner self-play training. Actor threads play games against their own copy of the
+// latest published weights and push the samples into per-actor SPSC rings; the calling
+// thread is the single learner: it drains the rings round-robin into a TrainingBatch, runs
+// trainBatch when it fills and publishes a new snapshot by atomic pointer swap. Actors only
+// copy the weights when the snapshot version moves.
+
+struct TrainingSample {
+    float input[9];
+    float target[9];
+    float weight;
+};
+
+constexpr size_t TRAINING_RING_CAPACITY = 1024;
+using TrainingRing = SpscRing<TrainingSample, TRAINING_RING_CAPACITY>;
+
+struct ParallelTrainingConfig {
+    int games = 5000;          // over all actors
+    int actors = 0;            // 0: one per hardware thread, less the learner
+    int batchSize = 32;
+    int publishEvery = 1;      // trained batches per snapshot
+    double learningRate = 0;   // 0: net.learningRate * samples in the batch (trainBatch averages)
+    uint32_t seed = 0;         // actor i gets std::mt19937(seed + i)
+};
+
+struct ParallelTrainingStats {
+    long long games = 0;
+    long long samples = 0;
+    long long batches = 0;
+    long long snapshots = 0;
+    double seconds = 0;
+};
+
+template <typename T>
+struct NetworkSnapshot {
+    uint64_t version = 0;
+    AlignedVector<T> weights_ih, weights_ho, bias_h, bias_o;
+};
+
+// play(net, rng, emit) plays one game with 'net' and calls emit(input, target, weight) for
+// each sample; onPublish(net) runs on the learner after each snapshot and returns false to
+// stop the actors early
+template <typename T, typename PlayFn, typename PublishFn>
+ParallelTrainingStats trainParallel(NeuralNetworkT<T>& net, const ParallelTrainingConfig& config, PlayFn play,
+                                    PublishFn onPublish) {
+    if (net.sharesWeights()) {
+        // publish() copies net's own weight vectors, which a view does not have
+        std::cerr << "❌ trainParallel needs a network that owns its weights, not a shareWeights() view.\n";
+        return {};
+    }
+    auto start = std::chrono::steady_clock::now();
+    const int actorCount = config.actors > 0 ? config.actors
+                                             : std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    const double savedRate = net.learningRate;
+
+    std::atomic<std::shared_ptr<const NetworkSnapshot<T>>> snapshot;
+    std::atomic<uint64_t> version{0};
+    std::atomic<int> gamesLeft{config.games};
+    std::atomic<long long> gamesPlayed{0};
+    std::atomic<int> actorsDone{0};
+    ParallelTrainingStats stats;
+
+    auto publish = [&] {
+        auto next = std::make_shared<NetworkSnapshot<T>>();
+        next->version = stats.snapshots + 1;
+        next->weights_ih = net.weights_ih;
+        next->weights_ho = net.weights_ho;
+        next->bias_h = net.bias_h;
+        next->bias_o = net.bias_o;
+        snapshot.store(std::move(next), std::memory_order_release);
+        version.store(++stats.snapshots, std::memory_order_release);
+    };
+    publish();
+
+    std::vector<std::unique_ptr<TrainingRing>> rings;
+    std::vector<NeuralNetworkT<T>> locals(actorCount, net); // copied before the learner starts
+    for (int a = 0; a < actorCount; ++a) rings.push_back(std::make_unique<TrainingRing>());
+
+    std::vector<std::thread> actors;
+    for (int a = 0; a < actorCount; ++a) {
+        actors.emplace_back([&, a] {
+            NeuralNetworkT<T>& local = locals[a];
+            std::mt19937 rng(config.seed + a);
+            uint64_t localVersion = 1;
+            TrainingRing& ring = *rings[a];
+            auto emit = [&](const std::vector<double>& input, const std::vector<double>& target, double weight) {
+                TrainingSample sample;
+                for (int i = 0; i < 9; ++i) {
+                    sample.input[i] = static_cast<float>(input[i]);
+                    sample.target[i] = static_cast<float>(target[i]);
+                }
+                sample.weight = static_cast<float>(weight);
+                ring.Push(sample);
+            };
+            while (gamesLeft.fetch_sub(1, std::memory_order_relaxed) > 0) {
+                if (version.load(std::memory_order_acquire) != localVersion) {
+                    auto current = snapshot.load(std::memory_order_acquire);
+                    local.weights_ih = current->weights_ih;
+                    local.weights_ho = current->weights_ho;
+                    local.bias_h = current->bias_h;
+                    local.bias_o = current->bias_o;
+                    localVersion = current->version;
+                }
+                play(local, rng, emit);
+                gamesPlayed.fetch_add(1, std::memory_order_relaxed);
+            }
+            actorsDone.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    TrainingBatch batch(9, 9, config.batchSize);
+    std::vector<double> input(9), target(9);
+    bool stopped = false;
+    auto train = [&] {
+        // Per batch, so a partial last batch takes the same per-game step as a full one
+        net.learningRate = config.learningRate > 0 ? config.learningRate : savedRate * batch.count;
+        net.trainBatch(batch);
+        batch.clear();
+        if (++stats.batches % std::max(1, config.publishEvery) == 0) {
+            publish();
+            if (!stopped && !onPublish(net)) {
+                stopped = true;
+                gamesLeft.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    while (true) {
+        // Read before draining: once every actor is done, an empty pass means no more samples
+        bool finished = actorsDone.load(std::memory_order_acquire) == actorCount;
+        bool any = false;
+        TrainingSample sample;
+        for (auto& ring : rings) {
+            while (ring->TryPop(sample)) {
+                for (int i = 0; i < 9; ++i) {
+                    input[i] = sample.input[i];
+                    target[i] = sample.target[i];
+                }
+                batch.add(input, target, sample.weight);
+                stats.samples++;
+                any = true;
+                if (batch.full()) train();
+            }
+        }
+        if (!any) {
+            if (finished) break;
+            std::this_thread::yield();
+        }
+    }
+    if (batch.count > 0) train();
+
+    for (auto& t : actors) t.join();
+    net.learningRate = savedRate;
+    stats.games = gamesPlayed.load();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+// The trainStep games, played by actors and learned in batches
+template <typename T>
+ParallelTrainingStats trainParallel(NeuralNetworkT<T>& net, const ParallelTrainingConfig& config = {}) {
+    return trainParallel(net, config,
+        [](NeuralNetworkT<T>& local, std::mt19937&, auto& emit) {
+            std::vector<double> input, target;
+            int plies = playTrainingGame(local, input, target);
+            if (plies > 0) emit(input, target, plies);
+        },
+        [](const NeuralNetworkT<T>&) { return true; });
+}
+
+// ----------------------------
+// Hogwild Training
+// ----------------------------
+
+// The other parallel mode: every thread runs forward/backprop on its own view of net's
+// weights (shareWeights) and updates them in place without locks. Views live on the worker
+// threads' stacks, so only the weights themselves are shared.
+
+struct HogwildConfig {
+    int threads = 0;           // 0: one per hardware thread
+    long long games = 5000;    // over all threads
+    uint32_t seed = 0;         // thread i gets std::mt19937(seed + i)
+};
+
+struct HogwildStats {
+    long long games = 0;
+    long long samples = 0;
+    double seconds = 0;
+};
+
+// play(worker, rng) plays one game, training 'worker', and returns the samples it learned
+template <typename T, typename PlayFn>
+HogwildStats trainHogwild(NeuralNetworkT<T>& net, const HogwildConfig& config, PlayFn play) {
+    auto start = std::chrono::steady_clock::now();
+    const int threadCount = config.threads > 0 ? config.threads
+                                               : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    // Non-owning: net outlives every view, all of which end before this returns
+    NeuralNetworkT<T> view = net;
+    view.shareWeights(std::shared_ptr<NeuralNetworkT<T>>(std::shared_ptr<void>(), &net));
+
+    std::atomic<long long> gamesLeft{config.games};
+    std::atomic<long long> games{0}, samples{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t] {
+            NeuralNetworkT<T> worker = view;
+            std::mt19937 rng(config.seed + t);
+            long long played = 0, learned = 0;
+            while (gamesLeft.fetch_sub(1, std::memory_order_relaxed) > 0) {
+                learned += play(worker, rng);
+                played++;
+            }
+            games.fetch_add(played, std::memory_order_relaxed);
+            samples.fetch_add(learned, std::memory_order_relaxed);
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    HogwildStats stats;
+    stats.games = games.load();
+    stats.samples = samples.load();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+// The trainStep games, Hogwild
+template <typename T>
+HogwildStats trainHogwild(NeuralNetworkT<T>& net, const HogwildConfig& config = {}) {
+    return trainHogwild(net, config, [](NeuralNetworkT<T>& worker, std::mt19937&) {
+        std::vector<double> input, target;
+        int plies = playTrainingGame(worker, input, target);
+        for (int i = 0; i < plies; ++i) worker.backprop(target);
+        return plies;
+    });
+}
+
+// ----------------------------
+// Model Registry
+// ----------------------------
+
+constexpr const char* TICTACTOE_MODEL_FILE    = "tictactoe_model.txt";
+constexpr const char* TICTACTOE_TF_MODEL_DIR  = "tictactoe_tf_model";
+
+// Process-wide models for RunTicTacToeSelfPlay: each is loaded on first use and shared by
+// every call and thread. A game never trains: when tictactoe_model.txt is missing the
+// standalone model stays empty until TrainStandalone() (the DLL's TrainTicTacToeModel) is
+// called at start-up or from a tool. No thread outlives the call that loads a model.
+class TicTacToeModelRegistry {
+public:
+    static TicTacToeModelRegistry& Instance() {
+        static TicTacToeModelRegistry registry;
+        return registry;
+    }
+
+    // This thread's view of the standalone network (NeuralNetworkT::shareWeights): the
+    // weights are shared, the forward() scratch is per thread. Null while there is no model;
+    // the file is read once, so a missing one costs no disk access per game.
+    NeuralNetwork* Standalone() {
+        std::call_once(standaloneLoaded, [this] { LoadStandalone(); });
+        if (!standaloneReady.load(std::memory_order_acquire)) return nullptr;
+        thread_local std::unique_ptr<NeuralNetwork> view;
+        if (!view) {
+            view = std::make_unique<NeuralNetwork>(*standalone);
+            view->shareWeights(standalone);
+        }
+        return view.get();
+    }
+
+    // Trains the standalone model (5,000 trainStep games, ~20 ms) and saves it, unless one is
+    // already loaded. Games running meanwhile keep failing until it is published.
+    void TrainStandalone() {
+        std::call_once(standaloneLoaded, [this] { LoadStandalone(); });
+        std::lock_guard<std::mutex> lock(trainMutex);
+        if (standaloneReady.load(std::memory_order_acquire)) return;
+        auto net = std::make_shared<NeuralNetwork>(9, 18, 9);
+        // Serial: trainParallel reaches 0.50-0.52 agreement against trainStep's 0.54, even
+        // with batch 1, since actors play on stale snapshots (test_tic_tac_toe_parallel_bench)
+        for (int g = 0; g < 5000; ++g) trainStep(*net);
+        if (!net->saveModel(TICTACTOE_MODEL_FILE))
+            std::cerr << "❌ Could not save " << TICTACTOE_MODEL_FILE << "; the model lasts for this process only.\n";
+        standalone = std::move(net);
+        standaloneReady.store(true, std::memory_order_release);
+    }
+
+    // Null if the SavedModel failed to load. The failure is kept for the life of the process
+    // rather than retried on every game; restart once the model directory is fixed.
+    TensorFlowTicTacToe* TensorFlow() {
+        std::call_once(tensorFlowLoaded, [this] {
+            tensorFlow = std::make_unique<TensorFlowTicTacToe>();
+            if (!tensorFlow->LoadModel(TICTACTOE_TF_MODEL_DIR)) tensorFlow.reset();
+        });
+        return tensorFlow.get();
+    }
+
+private:
+    std::shared_ptr<NeuralNetwork> standalone;  // set once, then published by standaloneReady
+    std::atomic<bool> standaloneReady{false};
+    std::unique_ptr<TensorFlowTicTacToe> tensorFlow;
+    std::once_flag standaloneLoaded, tensorFlowLoaded;
+    std::mutex trainMutex;
+
+    TicTacToeModelRegistry() = default;
+
+    void LoadStandalone() {
+        auto net = std::make_shared<NeuralNetwork>(9, 18, 9);
+        if (!net->loadModel(TICTACTOE_MODEL_FILE)) return;
+        standalone = std::move(net);
+        standaloneReady.store(true, std::memory_order_release);
+    }
+};
+
 // ----------------------------
 // Main Program Entrance
 // ----------------------------
@@ -689,56 +1748,44 @@ bool RunTicTacToeSelfPlay(TicTacToeResultOnline& result, int aiMode, double temp
     //////////////////////////////////////////////////////
 
 	//
-    TensorFlowTicTacToe tf;
-	NeuralNetwork       netStandalone(9, 18, 9);;		
-    TicTacToe game;
+    TicTacToeModelRegistry& models = TicTacToeModelRegistry::Instance();
+    TensorFlowTicTacToe*    tf = nullptr;
+	NeuralNetwork*          netStandalone = nullptr;	// this thread's view of the shared model
+    TicTacToeBits           game;	// two 9-bit masks; copied out to result through toArray()
 
    	//
-   	std::random_device              rd;
-    std::mt19937                    gen(rd());
     std::uniform_int_distribution<> starter(0, 1);
     int                             turn = (starter(gen) == 0) ? 1 : -1;
 
 	//
-    int              winner;
+    int              winner = 0;
 	int              move = -1;
-    std::vector<int> moves;
+    int              moveCount = 0;
+    std::vector<double> input;
 
 	//
-    for (int i = 0; i < 9; ++i) {
-        result.history[0][i] = game.board[i];
-    }
+    game.toArray(result.history[0]);
     result.historyCount = 1;
 
     //////////////////////////////////////////////////////
-    // MODEL LOAD 
+    // MODEL LOAD (once per process, see TicTacToeModelRegistry)
     //////////////////////////////////////////////////////
 
     if (aiMode == TENSORFLOW) {
 	    
-	    // load model
-	    const char* modelFile = "tictactoe_tf_model";
-		
 		//	
-		if (!tf.LoadModel(modelFile)) {
+		if (!(tf = models.TensorFlow())) {
 	        std::cerr << "❌ Failed to initialize TensorFlow model.\n";
 	        return false;
 	    }
 	    
 	} 
-	else 
+	else if (aiMode != MINIMAX)
 	{
-		// Load model
-	    const std::string modelFile = "tictactoe_model.txt";
-	
 		//
-	    if (aiMode != MINIMAX && !netStandalone.loadModel(modelFile)) {
-	     	
-			//
-	        for (int i = 0; i < 5000; ++i) 
-				trainStep(netStandalone);
-	        //
-			netStandalone.saveModel(modelFile);
+	    if (!(netStandalone = models.Standalone())) {
+	        std::cerr << "❌ No " << TICTACTOE_MODEL_FILE << "; train one first (TrainTicTacToeModel).\n";
+	        return false;
 	    }
 	}  
 
@@ -755,28 +1802,27 @@ bool RunTicTacToeSelfPlay(TicTacToeResultOnline& result, int aiMode, double temp
 		if (aiMode == TENSORFLOW) {
 		 	
             float input[9];
-			for (int i = 0; i < 9; ++i) input[i] = static_cast<float>(game.board[i]);
-		        if (!tf.PredictBestMove(input, move)) {
+			for (int i = 0; i < 9; ++i) input[i] = static_cast<float>(game.at(i));
+		        if (!tf->PredictBestMove(input, move)) {
 		            std::cerr << "❌ Prediction failed!\n";
 		            return false;
 		        }
 		        
 		} else if (aiMode == MINIMAX) {
-            move = minimaxMove(game.board, turn);
+            move = minimaxMove(game, turn);
         } else {
-            std::vector<double> input = boardToInput(game.board);
-            netStandalone.forward(input);
-            move = selectMove(netStandalone.output, game, aiMode, temperature);
+            boardToInput(game, input);
+            netStandalone->forward(input);
+            move = selectMove(netStandalone->output, game, aiMode, temperature);
         }
 
 		///////////////////////////////////////////
 		// VALIDATE MOVE
 		///////////////////////////////////////////
         
-		if (move < 0 || move >= 9 || game.board[move] != 0) {
-            auto valid = game.getValidMoves();
-            if (valid.empty()) break;
-            move = valid[0];
+		if (move < 0 || move >= 9 || !game.isEmpty(move)) {
+            if (game.emptyMask() == 0) break;
+            move = TicTacToeBits::lowestCell(game.emptyMask());
         }
 
 		///////////////////////////////////////////
@@ -784,14 +1830,12 @@ bool RunTicTacToeSelfPlay(TicTacToeResultOnline& result, int aiMode, double temp
 		///////////////////////////////////////////
 
 		//
-        game.board[move] = turn;
-        moves.push_back(move);
+        game.play(move, turn);
+        result.moves[moveCount++] = move;
 
 		//
         if (result.historyCount < 10) {
-            for (int i = 0; i < 9; ++i) {
-                result.history[result.historyCount][i] = game.board[i];
-            }
+            game.toArray(result.history[result.historyCount]);
             result.historyCount++;
         }
 
@@ -814,11 +1858,11 @@ bool RunTicTacToeSelfPlay(TicTacToeResultOnline& result, int aiMode, double temp
     //////////////////////////////////////////////////////
    
 	result.winner = winner;  
-    for (int i = 0; i < 9; ++i) {
-        result.finalBoard[i] = game.board[i];
-        result.moves[i] = (i < static_cast<int>(moves.size())) ? moves[i] : -1;
+    game.toArray(result.finalBoard);
+    for (int i = moveCount; i < 9; ++i) {
+        result.moves[i] = -1;
     }
-    result.moveCount          = static_cast<int>(moves.size());
+    result.moveCount          = moveCount;
 	
 	//
     return true;